@@ -0,0 +1,450 @@
+/*****************************************************************************
+ * This code builds src/fonts.c from the font sources listed in              *
+ * fonts/fonts.def. The sources are C-style tables with one glyph per        *
+ * {...} entry, each row a whole number of bytes, and a comment naming the   *
+ * character after each entry (lcdwiki's "c",n block comment or //c).        *
+ *                                                                           *
+ * Each glyph is cut down to the box around its set pixels and stored at 1   *
+ * bit per pixel, so blank rows and columns take no flash. Its metrics give  *
+ * where the box sits in the character cell and how far the cell advances.   *
+ * Only the characters a font is listed with are kept; a space is always     *
+ * kept and stands in for the others. A font can also be laid out            *
+ * proportionally, each glyph only as wide as its ink, and given kerning     *
+ * pairs, whose amounts are worked out from the shapes of the two glyphs.    *
+ *                                                                           *
+ * Build and run from the repository root:                                   *
+ *   gcc -O2 -Wall -o fontgen host/fontgen.c                                 *
+ *   ./fontgen fonts/fonts.def > src/fonts.c                                 *
+ *****************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <ctype.h>
+
+#define FONT_CHARS 95   //' ' to '~'
+#define MAX_HEIGHT 48
+#define MAX_WIDTH  24   //Rows are read as 32 bits, 7 of which may be skipped
+
+typedef struct {
+    int have;
+    uint32_t row[MAX_HEIGHT];   //Bit 0 is the leftmost pixel
+} src_glyph_t;
+
+static src_glyph_t glyph[FONT_CHARS];
+
+static void fail(const char *msg, const char *arg) {
+    fprintf(stderr, "fontgen: %s %s\n", msg, arg);
+    exit(1);
+}
+
+static char *read_file(const char *name) {
+    FILE *f = fopen(name, "rb");
+    if(!f)
+        fail("cannot open", name);
+    fseek(f, 0, SEEK_END);
+    long n = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    char *s = malloc(n + 1);
+    if(!s || fread(s, 1, n, f) != (size_t)n)
+        fail("cannot read", name);
+    s[n] = 0;
+    fclose(f);
+    return s;
+}
+
+//============================================================================
+// LOAD_SOURCE
+//  * Reads every {...} entry of a font source. The character an entry is
+//    for comes from the first comment after it. Glyphs already loaded for
+//    the same character are replaced.
+//============================================================================
+static void load_source(const char *name, int height) {
+    char *s = read_file(name);
+    uint8_t bytes[MAX_HEIGHT * 4];
+    int n = 0, in_glyph = 0, want_char = 0;
+
+    for(char *p = s; *p; ) {
+        int c = -1;
+        if(p[0] == '/' && p[1] == '*') {
+            char *e = strstr(p + 2, "*/");
+            if(!e)
+                fail("unterminated comment in", name);
+            if(p[2] == '"' && p[4] == '"')
+                c = p[3];
+            p = e + 2;
+        } else if(p[0] == '/' && p[1] == '/') {
+            c = p[2];
+            while(*p && *p != '\n')
+                p++;
+        } else if(*p == '{') {
+            in_glyph = 1;
+            n = 0;
+            p++;
+            continue;
+        } else if(*p == '}') {
+            if(!in_glyph)
+                fail("stray } in", name);
+            in_glyph = 0;
+            want_char = 1;
+            p++;
+            continue;
+        } else if(in_glyph && p[0] == '0' && (p[1] == 'x' || p[1] == 'X')) {
+            if(n == (int)sizeof(bytes))
+                fail("glyph too large in", name);
+            bytes[n++] = strtoul(p, &p, 16);
+            continue;
+        } else {
+            p++;
+            continue;
+        }
+
+        //A comment: the first one after an entry names its character
+        if(!want_char)
+            continue;
+        want_char = 0;
+        if(c < ' ' || c > '~')
+            fail("entry without a character in", name);
+        int bpr = n / height;
+        if(n % height || bpr * 8 < height / 2)
+            fail("entry of the wrong size in", name);
+        src_glyph_t *g = &glyph[c - ' '];
+        g->have = 1;
+        for(int r = 0; r < height; r++) {
+            uint32_t v = 0;
+            for(int b = 0; b < bpr; b++)
+                v = v << 8 | bytes[r*bpr + b];
+            g->row[r] = v & ((1u << height/2) - 1);
+        }
+    }
+    free(s);
+}
+
+typedef struct {
+    int x, y, w, h;
+} box_t;
+
+static box_t ink_box(const src_glyph_t *g, int height) {
+    box_t b = { 0, 0, 0, 0 };
+    int x0 = MAX_WIDTH, x1 = -1, y0 = -1, y1 = -1;
+    for(int r = 0; r < height; r++) {
+        if(!g->row[r])
+            continue;
+        if(y0 < 0)
+            y0 = r;
+        y1 = r;
+        for(int t = 0; t < height/2; t++)
+            if(g->row[r] >> t & 1) {
+                if(t < x0) x0 = t;
+                if(t > x1) x1 = t;
+            }
+    }
+    if(y0 >= 0) {
+        b.x = x0;
+        b.y = y0;
+        b.w = x1 - x0 + 1;
+        b.h = y1 - y0 + 1;
+    }
+    return b;
+}
+
+//============================================================================
+// LAYOUT
+//  * Places each glyph's box in its cell. A fixed-width font keeps the cells
+//    of its source, height/2 wide.
+//  * A proportional font starts each box at the left of its cell and
+//    advances past it by a small gap. Digits share the width of the widest
+//    one, so numbers keep their width as they change, and a space is a
+//    quarter of the height.
+//============================================================================
+typedef struct {
+    box_t b;        //Box in the source cell
+    int x;          //Box position in the generated cell
+    int advance;
+} metric_t;
+
+static metric_t metric[FONT_CHARS];
+
+static int gap_for(int height) {
+    return height/12 > 1 ? height/12 : 1;
+}
+
+static void layout(int height, int prop) {
+    int digit_w = 0;
+    for(int k = 0; k < FONT_CHARS; k++) {
+        metric[k].b = ink_box(&glyph[k], height);
+        metric[k].x = metric[k].b.x;
+        metric[k].advance = height/2;
+        if(k >= '0' - ' ' && k <= '9' - ' ' && metric[k].b.w > digit_w)
+            digit_w = metric[k].b.w;
+    }
+    if(!prop)
+        return;
+    for(int k = 0; k < FONT_CHARS; k++) {
+        metric_t *m = &metric[k];
+        if(m->b.w == 0) {
+            m->x = 0;
+            m->advance = height/4;
+        } else if(k >= '0' - ' ' && k <= '9' - ' ') {
+            m->x = (digit_w - m->b.w) / 2;
+            m->advance = digit_w + gap_for(height);
+        } else {
+            m->x = 0;
+            m->advance = m->b.w + gap_for(height);
+        }
+    }
+}
+
+static int ink_left(int k, int r) {
+    for(int t = 0; t < MAX_WIDTH; t++)
+        if(glyph[k].row[r] >> t & 1)
+            return metric[k].x + t - metric[k].b.x;
+    return -1;
+}
+
+static int ink_right(int k, int r) {
+    for(int t = MAX_WIDTH - 1; t >= 0; t--)
+        if(glyph[k].row[r] >> t & 1)
+            return metric[k].x + t - metric[k].b.x;
+    return -1;
+}
+
+//============================================================================
+// KERN_PAIR
+//  * How far right should be moved back when it follows left: the free
+//    columns between their ink, over every row and its neighbours (so the
+//    glyphs cannot touch diagonally), less the font's usual gap. Pairs that
+//    do not face each other on any row (such as "T.") move back by at most
+//    height/8, and a glyph never moves back past the start of left's cell.
+//============================================================================
+static int kern_pair(int height, int l, int r) {
+    int free = 1000;
+    for(int y = 0; y < height; y++) {
+        if(!glyph[l].row[y])
+            continue;
+        int right = ink_right(l, y);
+        for(int yy = y - 1; yy <= y + 1; yy++) {
+            if(yy < 0 || yy >= height || !glyph[r].row[yy])
+                continue;
+            int left = metric[l].advance + ink_left(r, yy);
+            if(left - right - 1 < free)
+                free = left - right - 1;
+        }
+    }
+    int kern = gap_for(height) - free;
+    int most = height/8 > 1 ? height/8 : 1;
+    if(kern < -most)
+        kern = -most;
+    if(kern < 1 - metric[l].advance)
+        kern = 1 - metric[l].advance;
+    return kern < 0 ? kern : 0;
+}
+
+static int col;     //Bytes written to the array so far
+
+static void put_byte(int v) {
+    printf("%s%s0x%02x", col ? "," : "", col % 12 ? " " : "\n    ", v);
+    col++;
+}
+
+static void put_char(int c) {
+    printf(c == '\'' || c == '\\' ? "'\\%c'" : "'%c'", c);
+}
+
+//============================================================================
+// EMIT_FONT
+//  * Writes the character map, the glyph metrics, the packed bitmaps and
+//    the kerning pairs of one font. Returns the flash it takes, in bytes.
+//============================================================================
+static int emit_font(int height, int prop, const char *keep, const char *pairs) {
+    char name[16];
+    int index[FONT_CHARS], kept = 0, last = 0;
+    sprintf(name, "font%d%s", height, prop ? "p" : "");
+
+    for(int k = 0; k < FONT_CHARS; k++) {
+        int want = k == 0 || !keep || strchr(keep, ' ' + k);
+        if(want && !glyph[k].have)
+            fprintf(stderr, "fontgen: font %d has no '%c'\n", height, ' ' + k);
+        index[k] = want && glyph[k].have ? kept++ : -1;
+        if(index[k] >= 0)
+            last = k;
+    }
+    if(index[0] < 0)
+        fail("no space glyph for", name);
+    layout(height, prop);
+
+    printf("\n//%d pixels high, %s, %d glyphs\n", height,
+           prop ? "proportional" : "fixed width", kept);
+    printf("static const u8 %s_map[%d] = {", name, last + 1);
+    col = 0;
+    for(int k = 0; k <= last; k++)
+        put_byte(index[k] < 0 ? 0 : index[k]);
+    printf("\n};\n\n");
+
+    printf("static const lcd_glyph_t %s_glyphs[%d] = {\n", name, kept);
+    printf("    //offset  x   y   w   h  advance\n");
+    int offset = 0;
+    for(int k = 0; k <= last; k++) {
+        if(index[k] < 0)
+            continue;
+        metric_t *m = &metric[k];
+        printf("    { %5d, %2d, %2d, %2d, %2d, %2d }, /*\"%c\"*/\n",
+               offset, m->x, m->b.y, m->b.w, m->b.h, m->advance, ' ' + k);
+        offset += (m->b.w * m->b.h + 7) / 8;
+    }
+    printf("};\n\n");
+
+    //Three spare bytes let the drawing code read any row as 32 bits
+    printf("static const u8 %s_bits[%d] = {", name, offset + 3);
+    col = 0;
+    for(int k = 0; k <= last; k++) {
+        if(index[k] < 0)
+            continue;
+        box_t b = metric[k].b;
+        int byte = 0, bit = 0;
+        for(int r = b.y; r < b.y + b.h; r++)
+            for(int t = b.x; t < b.x + b.w; t++) {
+                byte |= (glyph[k].row[r] >> t & 1) << bit;
+                if(++bit == 8) {
+                    put_byte(byte);
+                    byte = bit = 0;
+                }
+            }
+        if(bit)
+            put_byte(byte);
+    }
+    for(int k = 0; k < 3; k++)
+        put_byte(0);
+    printf("\n};\n");
+
+    int kerns = 0;
+    for(const char *p = pairs; p && p[0] && p[1]; p += p[2] ? 3 : 2) {
+        int l = p[0] - ' ', r = p[1] - ' ';
+        if(l < 0 || r < 0 || l >= FONT_CHARS || r >= FONT_CHARS ||
+           index[l] < 0 || index[r] < 0)
+            fail("kerning pair of characters not in", name);
+        int kern = kern_pair(height, l, r);
+        if(!kern)
+            continue;
+        if(!kerns++)
+            printf("\nstatic const lcd_kern_t %s_kern[] = {\n", name);
+        printf("    { ");
+        put_char(p[0]);
+        printf(", ");
+        put_char(p[1]);
+        printf(", %2d },\n", kern);
+    }
+    if(kerns)
+        printf("};\n");
+
+    printf("\nconst lcd_font_t lcd_%s = {\n    %d%s, %d, ' ', %d, %d,\n", name, height,
+           prop ? " | LCD_PROP" : "", height, last + 1, kerns);
+    printf("    %s_map, %s_glyphs, %s_bits, ", name, name, name);
+    if(kerns)
+        printf("%s_kern\n};\n", name);
+    else
+        printf("0\n};\n");
+    return last + 1 + kept*8 + offset + 3 + kerns*3 + 20;  //lcd_glyph_t is 8 bytes on ARM
+}
+
+//The font line being read; it is written out once its kerning line (if
+//any) has been seen
+static struct {
+    int height, prop;
+    char keep[128], *keep_p;
+    char pairs[256], *pairs_p;
+} font;
+
+static char names[8][16];
+static int fonts;
+
+static void finish_font(void) {
+    if(!font.height)
+        return;
+    int bytes = emit_font(font.height, font.prop, font.keep_p, font.pairs_p);
+    int full = FONT_CHARS * font.height * ((font.height/2 + 7) / 8);
+    fprintf(stderr, "font %2d%s: %5d bytes (%d as full tables)\n", font.height,
+            font.prop ? "p" : " ", bytes, full);
+    sprintf(names[fonts++], "font%d%s", font.height, font.prop ? "p" : "");
+    font.height = 0;
+}
+
+//Reads a "quoted" string; returns the character after it, or 0 if bad
+static char *quoted(char *p, char *out, int size) {
+    char *e = strchr(p + 1, '"');
+    if(*p != '"' || !e || e - p > size)
+        return 0;
+    memcpy(out, p + 1, e - p - 1);
+    out[e - p - 1] = 0;
+    return e + 1;
+}
+
+int main(int argc, char **argv) {
+    if(argc != 2) {
+        fprintf(stderr, "Usage: %s fonts.def > fonts.c\n", argv[0]);
+        return 1;
+    }
+    FILE *def = fopen(argv[1], "r");
+    if(!def)
+        fail("cannot open", argv[1]);
+
+    printf("/*****************************************************************************\n");
+    printf(" * Generated by host/fontgen.c from fonts/fonts.def; do not edit. Change     *\n");
+    printf(" * the font sources or fonts.def and run fontgen again.                      *\n");
+    printf(" *****************************************************************************/\n");
+    printf("#include \"stm32f0xx.h\"\n#include \"lcd.h\"\n");
+
+    char line[512];
+    while(fgets(line, sizeof(line), def)) {
+        char *p = line;
+        while(isspace((unsigned char)*p))
+            p++;
+        if(*p == '#' || *p == 0)
+            continue;
+
+        if(!strncmp(p, "kern", 4)) {
+            p += 4;
+            while(isspace((unsigned char)*p))
+                p++;
+            if(!font.height || !(p = quoted(p, font.pairs, sizeof(font.pairs))))
+                fail("bad kerning line in", argv[1]);
+            font.pairs_p = font.pairs;
+            continue;
+        }
+
+        finish_font();
+        font.height = strtol(p, &p, 10);
+        font.prop = *p == 'p';
+        if(font.prop)
+            p++;
+        if(font.height < 2 || font.height > MAX_HEIGHT || font.height/2 > MAX_WIDTH ||
+           fonts == 8)
+            fail("bad font size in", argv[1]);
+        while(isspace((unsigned char)*p))
+            p++;
+        font.keep_p = font.pairs_p = 0;
+        if(*p == '"') {
+            if(!(p = quoted(p, font.keep, sizeof(font.keep))))
+                fail("bad character list in", argv[1]);
+            font.keep_p = font.keep;
+        } else if(!strncmp(p, "all", 3))
+            p += 3;
+        else
+            fail("bad character list in", argv[1]);
+
+        memset(glyph, 0, sizeof(glyph));
+        char *src;
+        while((src = strtok(p, " \t\r\n"))) {
+            load_source(src, font.height);
+            p = 0;
+        }
+    }
+    finish_font();
+    fclose(def);
+
+    printf("\nconst lcd_font_t *const lcd_fonts[] = {\n   ");
+    for(int k = 0; k < fonts; k++)
+        printf(" &lcd_%s,", names[k]);
+    printf(" 0\n};\n");
+    return 0;
+}
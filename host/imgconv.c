@@ -0,0 +1,253 @@
+/*****************************************************************************
+ * This code converts a PPM image (binary P6, 8 bits per channel) into a C   *
+ * source file holding an lcd_image_t for LCD_DrawImage(). Images with up to *
+ * 16 colours become 1, 2 or 4-bit palette images; others are run-length     *
+ * coded, or left as plain RGB565 if run-length coding would not make them   *
+ * smaller. The sizes are reported on stderr.                                *
+ *                                                                           *
+ * Build and use from the repository root:                                   *
+ *   gcc -O2 -Wall -o imgconv host/imgconv.c                                 *
+ *   imgconv [-f auto|pal|rle|raw] heart.ppm heart_icon > src/heart_icon.c   *
+ *****************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+//Same numbering as the LCD_IMG_ formats in lcd.h
+enum { IMG_PAL1 = 1, IMG_PAL2 = 2, IMG_PAL4 = 4, IMG_RGB565 = 16, IMG_RLE565 = 17 };
+
+static int width, height;
+static uint16_t *pixels;
+static uint16_t palette[16];
+static int colors;
+
+static uint8_t *out;
+static int out_len, out_cap;
+
+static void emit(uint8_t b) {
+    if(out_len == out_cap) {
+        out_cap = out_cap ? 2*out_cap : 1024;
+        out = realloc(out, out_cap);
+        if(!out) {
+            fprintf(stderr, "imgconv: out of memory\n");
+            exit(1);
+        }
+    }
+    out[out_len++] = b;
+}
+
+static void emit_pixel(uint16_t c) {
+    emit(c & 0xff);
+    emit(c >> 8);
+}
+
+//============================================================================
+// PPM_FIELD
+//  * Reads one number of the PPM header, skipping whitespace and comments.
+//  * Returns the number, or -1 if there is none.
+//============================================================================
+static int ppm_field(FILE *f) {
+    int c, v = 0;
+    do {
+        c = fgetc(f);
+        if(c == '#')
+            while(c != '\n' && c != EOF)
+                c = fgetc(f);
+    } while(c == ' ' || c == '\t' || c == '\r' || c == '\n');
+    if(c < '0' || c > '9')
+        return -1;
+    while(c >= '0' && c <= '9') {
+        v = v*10 + c - '0';
+        c = fgetc(f);
+    }
+    return v;   //The single whitespace after maxval has been consumed
+}
+
+//============================================================================
+// READ_PPM
+//  * Loads a P6 file and converts it to RGB565.
+//  * Returns 0 on success, -1 if the file cannot be read.
+//============================================================================
+static int read_ppm(const char *name) {
+    FILE *f = fopen(name, "rb");
+    if(!f)
+        return -1;
+    int maxval;
+    if(fgetc(f) != 'P' || fgetc(f) != '6' ||
+       (width = ppm_field(f)) <= 0 || (height = ppm_field(f)) <= 0 ||
+       (maxval = ppm_field(f)) != 255 || width > 320 || height > 320) {
+        fclose(f);
+        return -1;
+    }
+    pixels = malloc(sizeof(*pixels) * width * height);
+    for(int i = 0; i < width*height; i++) {
+        int r = fgetc(f), g = fgetc(f), b = fgetc(f);
+        if(b == EOF) {
+            fclose(f);
+            return -1;
+        }
+        pixels[i] = (r >> 3) << 11 | (g >> 2) << 5 | b >> 3;
+    }
+    fclose(f);
+    return 0;
+}
+
+//============================================================================
+// FIND_PALETTE
+//  * Collects the image's colours. Returns their number, or 17 if there are
+//    more than fit a 4-bit palette.
+//============================================================================
+static int find_palette(void) {
+    colors = 0;
+    for(int i = 0; i < width*height; i++) {
+        int k;
+        for(k = 0; k < colors; k++)
+            if(palette[k] == pixels[i])
+                break;
+        if(k == colors) {
+            if(colors == 16)
+                return 17;
+            palette[colors++] = pixels[i];
+        }
+    }
+    return colors;
+}
+
+static int palette_index(uint16_t c) {
+    for(int k = 0; k < colors; k++)
+        if(palette[k] == c)
+            return k;
+    return 0;
+}
+
+static int encode_pal(void) {
+    int bpp = colors <= 2 ? 1 : colors <= 4 ? 2 : 4;
+    for(int y = 0; y < height; y++) {
+        int byte = 0, bits = 8;
+        for(int x = 0; x < width; x++) {
+            bits -= bpp;
+            byte |= palette_index(pixels[y*width + x]) << bits;
+            if(bits == 0) {
+                emit(byte);
+                byte = 0;
+                bits = 8;
+            }
+        }
+        if(bits != 8)   //Rows start on a new byte
+            emit(byte);
+    }
+    return bpp;
+}
+
+static int run_length(int i) {
+    int n = 1;
+    while(i + n < width*height && n < 128 && pixels[i + n] == pixels[i])
+        n++;
+    return n;
+}
+
+//============================================================================
+// ENCODE_RLE
+//  * Two or more equal pixels become a repeat packet. Other pixels are
+//    gathered into literal packets of up to 128.
+//============================================================================
+static int encode_rle(void) {
+    int i = 0, total = width*height;
+    while(i < total) {
+        int n = run_length(i);
+        if(n >= 2) {
+            emit(0x80 | (n - 1));
+            emit_pixel(pixels[i]);
+            i += n;
+            continue;
+        }
+        n = 1;
+        while(i + n < total && n < 128 && run_length(i + n) < 2)
+            n++;
+        emit(n - 1);
+        for(int k = 0; k < n; k++)
+            emit_pixel(pixels[i + k]);
+        i += n;
+    }
+    return IMG_RLE565;
+}
+
+static int encode_raw(void) {
+    for(int i = 0; i < width*height; i++)
+        emit_pixel(pixels[i]);
+    return IMG_RGB565;
+}
+
+static const char *format_name(int format) {
+    switch(format) {
+    case IMG_PAL1:   return "LCD_IMG_PAL1";
+    case IMG_PAL2:   return "LCD_IMG_PAL2";
+    case IMG_PAL4:   return "LCD_IMG_PAL4";
+    case IMG_RLE565: return "LCD_IMG_RLE565";
+    default:         return "LCD_IMG_RGB565";
+    }
+}
+
+int main(int argc, char **argv) {
+    const char *mode = "auto";
+    int a = 1;
+    if(a + 1 < argc && !strcmp(argv[a], "-f")) {
+        mode = argv[a + 1];
+        a += 2;
+    }
+    if(argc - a != 2) {
+        fprintf(stderr, "Usage: %s [-f auto|pal|rle|raw] image.ppm name\n", argv[0]);
+        return 1;
+    }
+    const char *file = argv[a], *name = argv[a + 1];
+    if(read_ppm(file) < 0) {
+        fprintf(stderr, "imgconv: %s is not a readable 8-bit P6 PPM\n", file);
+        return 1;
+    }
+
+    int format, n = find_palette();
+    if(!strcmp(mode, "pal")) {
+        if(n > 16) {
+            fprintf(stderr, "imgconv: %s has more than 16 colours\n", file);
+            return 1;
+        }
+        format = encode_pal();
+    } else if(!strcmp(mode, "rle"))
+        format = encode_rle();
+    else if(!strcmp(mode, "raw"))
+        format = encode_raw();
+    else if(n <= 16)
+        format = encode_pal();
+    else {
+        format = encode_rle();
+        if(out_len >= 2*width*height) {
+            out_len = 0;
+            format = encode_raw();
+        }
+    }
+
+    printf("// %s: %dx%d, made from %s by host/imgconv.c\n", name, width, height, file);
+    printf("#include \"stm32f0xx.h\"\n#include \"lcd.h\"\n\n");
+    if(format <= IMG_PAL4) {
+        printf("static const u16 %s_palette[%d] = {", name, 1 << format);
+        for(int k = 0; k < 1 << format; k++)
+            printf("%s0x%04x", k ? ", " : "", k < colors ? palette[k] : 0);
+        printf("};\n\n");
+    }
+    printf("static const u8 %s_data[%d] = {", name, out_len);
+    for(int i = 0; i < out_len; i++)
+        printf("%s0x%02x", i % 12 ? ", " : (i ? ",\n    " : "\n    "), out[i]);
+    printf("\n};\n\n");
+    printf("const lcd_image_t %s = { %d, %d, %s, %s%s, %s_data };\n", name,
+           width, height, format_name(format),
+           format <= IMG_PAL4 ? name : "0", format <= IMG_PAL4 ? "_palette" : "",
+           name);
+
+    int raw = 2*width*height;
+    int total = out_len + (format <= IMG_PAL4 ? 2 << format : 0);
+    fprintf(stderr, "%s: %dx%d, %d colours%s, %s, %d bytes (RGB565 %d bytes, %d%%)\n",
+            name, width, height, n > 16 ? 16 : n, n > 16 ? "+" : "",
+            format_name(format), total, raw, total*100 / raw);
+    return 0;
+}
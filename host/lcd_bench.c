@@ -0,0 +1,117 @@
+/*****************************************************************************
+ * This code measures what each LCD drawing primitive sends the panel. It    *
+ * runs the unmodified src/lcd.c and src/lcd_spi.c against sim_lcd.c and     *
+ * prints, for every primitive, the command, parameter and pixel traffic,    *
+ * the number of address commands and bus drains, and the time the bytes     *
+ * take on a 24MHz SPI link.                                                 *
+ *                                                                           *
+ * With -o, the screen after each primitive is saved as dir/NN.ppm; two runs *
+ * can be compared with "cmp" to check that a change renders the same. With  *
+ * -l, the traffic of every drawing call is printed as well.                 *
+ *                                                                           *
+ * Build from the repository root:                                           *
+ *   gcc -O2 -funsigned-char -no-pie -Ihost -Iinc -o lcd_bench \             *
+ *       host/lcd_bench.c host/sim_lcd.c src/lcd.c src/lcd_spi.c \           *
+ *       src/fonts.c src/display.c src/chart.c                               *
+ *   lcd_bench [-o dir] [-l]                                                 *
+ *****************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "sim_lcd.h"
+#include "stm32f0xx.h"
+#include "lcd.h"
+#include "display.h"
+#include "chart.h"
+
+RCC_TypeDef sim_rcc;
+NVIC_Type   sim_nvic;
+
+static sim_lcd_stats_t before;
+static const char *shots;
+static int cases;
+
+//The panel's reset and sleep-out waits take no time here.
+void sim_nano_wait(unsigned int ns) {
+}
+
+static void start(void) {
+    sim_lcd_sync();
+    before = sim_lcd_stats;
+}
+
+static void report(const char *name) {
+    sim_lcd_sync();
+    sim_lcd_stats_t d;
+    d.commands = sim_lcd_stats.commands - before.commands;
+    d.params   = sim_lcd_stats.params   - before.params;
+    d.pixels   = sim_lcd_stats.pixels   - before.pixels;
+    d.windows  = sim_lcd_stats.windows  - before.windows;
+    d.drains   = sim_lcd_stats.drains   - before.drains;
+    uint32_t bytes = sim_lcd_bytes(&d);
+    printf("%-24s %7u %7u %7u %6u %6u %8u %9.1f\n", name, d.commands, d.params,
+           d.pixels, d.windows, d.drains, bytes, bytes * 8.0 * 1e6 / SIM_LCD_SPI_HZ);
+    if(shots) {
+        char file[256];
+        snprintf(file, sizeof(file), "%s/%02d.ppm", shots, ++cases);
+        if(sim_lcd_save_ppm(file) < 0)
+            fprintf(stderr, "lcd_bench: cannot write %s\n", file);
+    }
+}
+
+#define BENCH(name, call) do { start(); call; report(name); } while(0)
+
+int main(int argc, char **argv) {
+    for(int a = 1; a < argc; a++) {
+        if(!strcmp(argv[a], "-o") && a + 1 < argc)
+            shots = argv[++a];
+        else if(!strcmp(argv[a], "-l"))
+            sim_lcd_log(stdout);
+        else {
+            fprintf(stderr, "Usage: %s [-o dir] [-l]\n", argv[0]);
+            return 1;
+        }
+    }
+    LCD_Setup();
+    printf("%-24s %7s %7s %7s %6s %6s %8s %9s\n", "primitive", "cmds", "params",
+           "pixels", "wins", "drains", "bytes", "spi_us");
+
+    BENCH("point",                LCD_DrawPoint(10, 10, RED));
+    BENCH("hline 200",            LCD_DrawLine(10, 20, 209, 20, RED));
+    BENCH("vline 200",            LCD_DrawLine(20, 10, 20, 209, RED));
+    BENCH("line 200x100",         LCD_DrawLine(10, 10, 209, 109, RED));
+    BENCH("line 50x200",          LCD_DrawLine(10, 10, 59, 209, RED));
+    BENCH("rect 100x50",          LCD_DrawRectangle(10, 10, 109, 59, RED));
+    BENCH("fill rect 100x50",     LCD_DrawFillRectangle(10, 10, 109, 59, RED));
+    BENCH("triangle",             LCD_DrawTriangle(10, 10, 150, 40, 60, 200, RED));
+    BENCH("fill triangle",        LCD_DrawFillTriangle(10, 10, 150, 40, 60, 200, RED));
+    BENCH("circle r30",           LCD_Circle(100, 100, 30, 0, RED));
+    BENCH("fill circle r30",      LCD_Circle(100, 100, 30, 1, RED));
+    BENCH("fill circle off edge", LCD_Circle(10, 230, 30, 1, RED));
+    BENCH("char 16 transparent",  LCD_DrawChar(10, 10, WHITE, BLACK, '8', 16, 1));
+    BENCH("char 16 opaque",       LCD_DrawChar(10, 10, WHITE, BLACK, '8', 16, 0));
+    BENCH("char 48 transparent",  LCD_DrawChar(10, 10, WHITE, BLACK, '8', 48, 1));
+    BENCH("char 48 opaque",       LCD_DrawChar(10, 10, WHITE, BLACK, '8', 48, 0));
+    BENCH("string 48 \"12:34\"",  LCD_DrawString(104, 96, WHITE, BLACK, "12:34", 48, 0));
+    BENCH("menu prompt",          LCD_DrawString(10, 219, BLACK, WHITE, "--ADJUST WGT--", 16, 0));
+    BENCH("menu prompt, prop",    LCD_DrawString(10, 219, BLACK, WHITE, "--ADJUST WGT--", 16|LCD_PROP, 0));
+    BENCH("clear",                LCD_Clear(BLACK));
+    BENCH("setup again (resume)", LCD_Setup());
+    BENCH("sleep in, sleep out",  { LCD_Sleep(1); LCD_Sleep(0); });
+
+    for(int k = 0; k < DISP_FIELDS; k++)
+        display_set(k, 0);
+    BENCH("face: full draw",      display_draw_all());
+    display_set(DISP_HR, 72);
+    BENCH("face: one vital",      display_update());
+    display_set(DISP_TIME, 12*60 + 35);
+    BENCH("face: clock minute",   display_update());
+    display_set(DISP_TIME, 12*60 + 36);
+    BENCH("face: 12:35 -> 12:36",  display_update());
+    display_set(DISP_STEPS, 1);
+    BENCH("face: steps 0 -> 1",   display_update());
+    for(int k = 0; k < 10; k++)
+        display_trend(72, 97);
+    BENCH("face: chart column",   display_update());
+    BENCH("chart: full redraw",   chart_draw_all());
+    return 0;
+}
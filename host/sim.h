@@ -0,0 +1,84 @@
+/*****************************************************************************
+ * This header gives the host-side simulation of the I2C bus. The functions  *
+ * in i2c.h are re-implemented in sim_i2c.c and routed to behavioural        *
+ * register models of the four devices on the watch's bus:                   *
+ *     MPU6050  (0x69) accelerometer data registers                          *
+ *     MAX30102 (0x57) PPG FIFO with read/write pointers and roll-over       *
+ *     PCF8523  (0x68) BCD calendar registers and Timer A                    *
+ *     HDC1080  (0x40) temperature conversion                                *
+ * The physical quantities the models report come from waveforms, which      *
+ * are either scripted (a function of time) or recorded (a CSV file).        *
+ *                                                                           *
+ * Build from the repository root. -funsigned-char matches the ARM ABI,      *
+ * which the drivers rely on when they assemble bytes read into char arrays: *
+ *   gcc -O2 -funsigned-char -Ihost -Iinc -o watch_sim host/sim_main.c \     *
+ *       host/sim_i2c.c host/sim_devices.c host/sim_waveform.c \             *
+ *       src/sensors.c src/rtc.c src/clock.c src/history.c \                 *
+ *       src/accelerometer_algorithms.c src/bus_scheduler.c -lm              *
+ *****************************************************************************/
+#ifndef __SIM_H
+#define __SIM_H
+#include <stdint.h>
+
+//============================================================================
+// WAVEFORMS
+//  * One channel per physical quantity fed into the device models.
+//  * Units: acceleration in g, PPG in raw 18-bit ADC counts, temperature in C
+//============================================================================
+enum {
+    SIM_ACCEL_X = 0,
+    SIM_ACCEL_Y,
+    SIM_ACCEL_Z,
+    SIM_PPG_RED,
+    SIM_PPG_IR,
+    SIM_TEMP_C,
+    SIM_CHANNELS
+};
+
+typedef double (*sim_script_t)(int channel, double t);  //t in seconds
+
+void   sim_waveform_script(sim_script_t script);    //Use a scripted waveform
+int    sim_waveform_load(const char *path);         //Use a recorded CSV file
+double sim_waveform(int channel, double t);         //Value at time t
+double sim_walk_script(int channel, double t);      //Built-in walking wrist
+
+//============================================================================
+// SIMULATED TIME AND BUS
+//  * Time only advances through sim_advance() and through the bus time spent
+//    by each I2C transaction (100kHz, 9 clocks per byte). The drivers'
+//    nano_wait() busy loops also advance it (see stm32f0xx.h).
+//============================================================================
+typedef struct {
+    uint32_t transactions;
+    uint32_t bytes;
+    uint32_t nacks;
+    uint64_t bus_us;
+} sim_i2c_stats_t;
+
+extern uint64_t        sim_time_us;
+extern sim_i2c_stats_t sim_i2c_stats;
+
+void sim_init(void);                  //Reset every device model and the clock
+void sim_advance(uint64_t us);        //Let simulated time pass
+void sim_set_datetime(int year, int month, int day, int dayofweek,
+                      int hour, int minute, int second);
+int  sim_rtc_int1(void);              //1 while the PCF8523 ~INT1 pin is low
+
+//============================================================================
+// DEVICE MODELS
+//  * Each model sees the same byte-level view of the bus a real device does.
+//    start() and write() return 0 to ACK the address/byte, -1 to NACK it.
+//============================================================================
+typedef struct sim_device {
+    uint8_t addr;
+    int     (*start)(struct sim_device *dev, int read);
+    int     (*write)(struct sim_device *dev, uint8_t byte);
+    uint8_t (*read)(struct sim_device *dev);
+    void    (*stop)(struct sim_device *dev);
+    void    (*advance)(struct sim_device *dev, uint64_t now_us);
+    void    (*reset)(struct sim_device *dev);
+} sim_device_t;
+
+sim_device_t *sim_find_device(uint8_t addr);
+
+#endif
@@ -0,0 +1,504 @@
+/*****************************************************************************
+ * This code contains the behavioural register models of the devices on the  *
+ * watch's I2C bus. Only the registers the firmware uses (and the ones a     *
+ * careful driver would check) are modelled; everything else reads back      *
+ * what was last written.                                                    *
+ *****************************************************************************/
+#include <string.h>
+#include <math.h>
+#include "sim.h"
+
+#define ACCELEROMETER_ADDR  0x69
+#define PULSEOX_ADDR        0x57
+#define WATCH_ADDR          0x68
+#define HDC_ADDR            0x40
+
+uint64_t sim_time_us;
+
+static uint8_t to_bcd(int val)      { return ((val / 10) << 4) | (val % 10); }
+static int     from_bcd(uint8_t val) { return (val >> 4)*10 + (val & 0xf); }
+static double  now_s(void)          { return sim_time_us / 1e6; }
+
+//============================================================================
+// MPU6050
+//  * Register pointer auto-increments on every data byte.
+//  * ACCEL_XOUT_H..ACCEL_ZOUT_L (0x3B..0x40) are refreshed at 1kHz from the
+//    waveform, scaled by the full-scale range in ACCEL_CONFIG (0x1C).
+//  * Nothing updates while PWR_MGMT_1 (0x6B) has SLEEP set, which is the
+//    power-on and post-DEVICE_RESET state.
+//============================================================================
+static struct {
+    uint8_t  regs[128];
+    uint8_t  ptr;
+    int      addressed;
+    uint64_t last_ms;
+} mpu;
+
+static void mpu_reset(sim_device_t *dev) {
+    memset(&mpu, 0, sizeof(mpu));
+    mpu.regs[0x6b] = 0x40;          //SLEEP
+    mpu.regs[0x75] = 0x68;          //WHO_AM_I
+}
+
+static int mpu_start(sim_device_t *dev, int read) {
+    mpu.addressed = read;
+    return 0;
+}
+
+static int mpu_write(sim_device_t *dev, uint8_t byte) {
+    if(!mpu.addressed) {            //First byte is the register address
+        mpu.ptr = byte & 0x7f;
+        mpu.addressed = 1;
+        return 0;
+    }
+    if(mpu.ptr == 0x6b && (byte & 0x80)) {
+        mpu_reset(dev);             //DEVICE_RESET
+        return 0;
+    }
+    mpu.regs[mpu.ptr] = byte;
+    mpu.ptr = (mpu.ptr + 1) & 0x7f;
+    return 0;
+}
+
+static uint8_t mpu_read(sim_device_t *dev) {
+    uint8_t val = mpu.regs[mpu.ptr];
+    mpu.ptr = (mpu.ptr + 1) & 0x7f;
+    return val;
+}
+
+static void mpu_stop(sim_device_t *dev) {
+}
+
+static void mpu_advance(sim_device_t *dev, uint64_t now_us) {
+    if(mpu.regs[0x6b] & 0x40 || now_us/1000 == mpu.last_ms)
+        return;
+    mpu.last_ms = now_us/1000;
+    double lsb_per_g = 16384 >> ((mpu.regs[0x1c] >> 3) & 0x3);
+    for(int axis = 0; axis < 3; axis++) {
+        double raw = sim_waveform(SIM_ACCEL_X + axis, now_us/1e6) * lsb_per_g;
+        if(raw >  32767) raw =  32767;
+        if(raw < -32768) raw = -32768;
+        int16_t val = (int16_t)lrint(raw);
+        mpu.regs[0x3b + 2*axis]     = (uint16_t)val >> 8;
+        mpu.regs[0x3b + 2*axis + 1] = (uint16_t)val & 0xff;
+    }
+}
+
+//============================================================================
+// MAX30102
+//  * 32-sample FIFO. A sample is produced every (averages / sample rate)
+//    seconds from FIFO_CONFIG (0x08) and SPO2_CONFIG (0x0A) while
+//    MODE_CONFIG (0x09) selects HR (red only) or SpO2/multi-LED (red, IR).
+//  * Writing a sample to a full FIFO bumps OVF_COUNTER (0x05) and either
+//    drops the sample or, with FIFO_ROLL_OVER_EN, overwrites the oldest one
+//    and advances FIFO_RD_PTR.
+//  * FIFO_DATA (0x07) does not auto-increment the register pointer. Each
+//    sample is 3 bytes per active LED, MSB first, 18 bits right-justified.
+//    FIFO_RD_PTR advances once a whole sample has been read. Reading an
+//    empty FIFO returns the last sample popped and leaves the pointers.
+//============================================================================
+static struct {
+    uint8_t  regs[256];
+    uint8_t  ptr;
+    int      addressed;
+    uint32_t fifo[32][2];
+    uint32_t last[2];
+    int      count;
+    int      byte;
+    uint64_t next_us;
+} ppg;
+
+static int ppg_leds(void) {
+    switch(ppg.regs[0x09] & 0x7) {
+    case 2:  return 1;
+    case 3:
+    case 7:  return 2;
+    }
+    return 0;
+}
+
+static uint64_t ppg_period_us(void) {
+    static const int rate[8] = {50,100,200,400,800,1000,1600,3200};
+    int avg = 1 << ((ppg.regs[0x08] >> 5) & 0x7);
+    if(avg > 32)
+        avg = 32;
+    return (uint64_t)1000000 * avg / rate[(ppg.regs[0x0a] >> 2) & 0x7];
+}
+
+static void ppg_reset(sim_device_t *dev) {
+    memset(&ppg, 0, sizeof(ppg));
+    ppg.regs[0xfe] = 0x03;          //REV_ID
+    ppg.regs[0xff] = 0x15;          //PART_ID
+}
+
+static void ppg_push(uint32_t red, uint32_t ir) {
+    uint8_t *wr  = &ppg.regs[0x04];
+    uint8_t *ovf = &ppg.regs[0x05];
+    uint8_t *rd  = &ppg.regs[0x06];
+    if(ppg.count == 32) {
+        if(*ovf < 0x1f)
+            (*ovf)++;
+        if(!(ppg.regs[0x08] & 0x10))
+            return;                 //No roll-over: new sample is lost
+        *rd = (*rd + 1) & 0x1f;
+        ppg.count--;
+    }
+    ppg.fifo[*wr][0] = red;
+    ppg.fifo[*wr][1] = ir;
+    *wr = (*wr + 1) & 0x1f;
+    ppg.count++;
+    if(ppg.count >= 32 - (ppg.regs[0x08] & 0xf))
+        ppg.regs[0x00] |= 0x80;     //A_FULL
+}
+
+static int ppg_start(sim_device_t *dev, int read) {
+    ppg.addressed = read;
+    ppg.byte = 0;
+    return 0;
+}
+
+static int ppg_write(sim_device_t *dev, uint8_t byte) {
+    if(!ppg.addressed) {
+        ppg.ptr = byte;
+        ppg.addressed = 1;
+        return 0;
+    }
+    if(ppg.ptr == 0x09 && (byte & 0x40)) {
+        ppg_reset(dev);             //RESET
+        return 0;
+    }
+    ppg.regs[ppg.ptr] = byte;
+    if(ppg.ptr >= 0x04 && ppg.ptr <= 0x06) {
+        ppg.regs[ppg.ptr] &= 0x1f;
+        ppg.count = (ppg.regs[0x04] - ppg.regs[0x06]) & 0x1f;
+    }
+    if(ppg.ptr == 0x09)
+        ppg.next_us = sim_time_us + ppg_period_us();
+    if(ppg.ptr != 0x07)
+        ppg.ptr++;
+    return 0;
+}
+
+static uint8_t ppg_read(sim_device_t *dev) {
+    if(ppg.ptr != 0x07) {
+        uint8_t val = ppg.regs[ppg.ptr];
+        if(ppg.ptr == 0x00)
+            ppg.regs[0x00] = 0;     //Interrupt status clears on read
+        ppg.ptr++;
+        return val;
+    }
+
+    int leds = ppg_leds() ? ppg_leds() : 1;
+    uint8_t *rd = &ppg.regs[0x06];
+    if(ppg.byte == 0 && ppg.count) {
+        ppg.last[0] = ppg.fifo[*rd][0];
+        ppg.last[1] = ppg.fifo[*rd][1];
+    }
+    uint32_t sample = ppg.last[ppg.byte/3];
+    uint8_t  val    = sample >> (8*(2 - ppg.byte%3));
+    if(++ppg.byte == 3*leds) {
+        ppg.byte = 0;
+        if(ppg.count) {
+            *rd = (*rd + 1) & 0x1f;
+            ppg.count--;
+        }
+    }
+    return val;
+}
+
+static void ppg_stop(sim_device_t *dev) {
+}
+
+static uint32_t ppg_adc(int channel, double t) {
+    double val = sim_waveform(channel, t);
+    if(val < 0)       val = 0;
+    if(val > 0x3ffff) val = 0x3ffff;
+    return (uint32_t)val;
+}
+
+static void ppg_advance(sim_device_t *dev, uint64_t now_us) {
+    if(ppg_leds() == 0)
+        return;
+    while(ppg.next_us <= now_us) {
+        double t = ppg.next_us / 1e6;
+        ppg_push(ppg_adc(SIM_PPG_RED, t),
+                 ppg_leds() == 2 ? ppg_adc(SIM_PPG_IR, t) : 0);
+        ppg.next_us += ppg_period_us();
+    }
+}
+
+//============================================================================
+// PCF8523
+//  * Calendar kept in binary and presented as BCD in 0x03..0x09. As on the
+//    real part, the time registers are latched at the START of an access so
+//    a single burst read cannot tear, but separate transactions can.
+//  * Writing the seconds register clears the sub-second prescaler.
+//  * Timer A counts down when TAC (0x0F bits 2:1) is 01, from the source in
+//    Tmr_A_freq_ctrl (0x10), reloading from Tmr_A_reg (0x11). On expiry it
+//    sets CTAF (0x01 bit 6); with CTAIE (0x01 bit 1) ~INT1 goes low, either
+//    until CTAF is cleared or, with TAM (0x0F bit 7), for a 1/64s pulse.
+//============================================================================
+static struct {
+    uint8_t  regs[0x14];
+    uint8_t  ptr;
+    int      addressed;
+    int      sec, min, hour, day, wday, month, year;
+    int      os;
+    uint64_t tick_us;               //Time of the last whole second
+    uint64_t timer_us;              //Time of the last Timer A source tick
+    int      timer_count;
+    uint64_t pulse_end_us;
+} rtc;
+
+static int rtc_days_in_month(int month, int year) {
+    static const int days[12] = {31,28,31,30,31,30,31,31,30,31,30,31};
+    if(month == 2 && year % 4 == 0)
+        return 29;
+    return days[month - 1];
+}
+
+static void rtc_latch(void) {
+    rtc.regs[0x03] = to_bcd(rtc.sec) | (rtc.os << 7);
+    rtc.regs[0x04] = to_bcd(rtc.min);
+    rtc.regs[0x05] = to_bcd(rtc.hour);
+    rtc.regs[0x06] = to_bcd(rtc.day);
+    rtc.regs[0x07] = rtc.wday;
+    rtc.regs[0x08] = to_bcd(rtc.month);
+    rtc.regs[0x09] = to_bcd(rtc.year);
+}
+
+static void rtc_reset(sim_device_t *dev) {
+    memset(&rtc, 0, sizeof(rtc));
+    rtc.regs[0x02] = 0xe0;
+    rtc.regs[0x0f] = 0x38;
+    rtc.regs[0x10] = 0x07;
+    rtc.os    = 1;
+    rtc.day   = 1;
+    rtc.wday  = 6;                  //2000-01-01 was a Saturday
+    rtc.month = 1;
+    rtc_latch();
+}
+
+static void rtc_second(void) {
+    if(++rtc.sec < 60) return;
+    rtc.sec = 0;
+    if(++rtc.min < 60) return;
+    rtc.min = 0;
+    if(++rtc.hour < 24) return;
+    rtc.hour = 0;
+    rtc.wday = (rtc.wday + 1) % 7;
+    if(++rtc.day <= rtc_days_in_month(rtc.month, rtc.year)) return;
+    rtc.day = 1;
+    if(++rtc.month <= 12) return;
+    rtc.month = 1;
+    rtc.year = (rtc.year + 1) % 100;
+}
+
+static void rtc_timer_a(void) {
+    if(--rtc.timer_count > 0)
+        return;
+    rtc.timer_count = rtc.regs[0x11];
+    rtc.regs[0x01] |= 0x40;         //CTAF
+    rtc.pulse_end_us = rtc.timer_us + 1000000/64;
+}
+
+static int rtc_start(sim_device_t *dev, int read) {
+    rtc.addressed = read;
+    rtc_latch();
+    return 0;
+}
+
+static int rtc_write(sim_device_t *dev, uint8_t byte) {
+    if(!rtc.addressed) {
+        rtc.ptr = byte % 0x14;
+        rtc.addressed = 1;
+        return 0;
+    }
+    switch(rtc.ptr) {
+    case 0x00:
+        if(byte == 0x58) {          //Software reset command
+            rtc_reset(dev);
+            return 0;
+        }
+        break;
+    case 0x03:
+        rtc.os  = byte >> 7;
+        rtc.sec = from_bcd(byte & 0x7f);
+        rtc.tick_us = sim_time_us;
+        break;
+    case 0x04: rtc.min   = from_bcd(byte & 0x7f); break;
+    case 0x05: rtc.hour  = from_bcd(byte & 0x3f); break;
+    case 0x06: rtc.day   = from_bcd(byte & 0x3f); break;
+    case 0x07: rtc.wday  = byte & 0x07;           break;
+    case 0x08: rtc.month = from_bcd(byte & 0x1f); break;
+    case 0x09: rtc.year  = from_bcd(byte);        break;
+    case 0x11:
+        rtc.timer_count = byte;
+        rtc.timer_us = sim_time_us;
+        break;
+    }
+    rtc.regs[rtc.ptr] = byte;
+    rtc.ptr = (rtc.ptr + 1) % 0x14;
+    return 0;
+}
+
+static uint8_t rtc_read(sim_device_t *dev) {
+    uint8_t val = rtc.regs[rtc.ptr];
+    rtc.ptr = (rtc.ptr + 1) % 0x14;
+    return val;
+}
+
+static void rtc_stop(sim_device_t *dev) {
+}
+
+static void rtc_advance(sim_device_t *dev, uint64_t now_us) {
+    static const uint64_t timer_period_us[8] = {
+        244, 15625, 1000000, 60000000, 3600000000ULL, 3600000000ULL,
+        3600000000ULL, 3600000000ULL
+    };
+    if(rtc.regs[0x00] & 0x20) {     //STOP bit freezes the calendar
+        rtc.tick_us = now_us;
+        return;
+    }
+    while(now_us - rtc.tick_us >= 1000000) {
+        rtc.tick_us += 1000000;
+        rtc_second();
+    }
+    if(((rtc.regs[0x0f] >> 1) & 0x3) != 1) {
+        rtc.timer_us = now_us;
+        return;
+    }
+    uint64_t period = timer_period_us[rtc.regs[0x10] & 0x7];
+    while(now_us - rtc.timer_us >= period) {
+        rtc.timer_us += period;
+        rtc_timer_a();
+    }
+}
+
+void sim_set_datetime(int year, int month, int day, int dayofweek,
+                      int hour, int minute, int second) {
+    rtc.year  = year % 100;
+    rtc.month = month;
+    rtc.day   = day;
+    rtc.wday  = dayofweek;
+    rtc.hour  = hour;
+    rtc.min   = minute;
+    rtc.sec   = second;
+    rtc.os    = 0;
+    rtc.tick_us = sim_time_us;
+    rtc_latch();
+}
+
+int sim_rtc_int1(void) {
+    if(!(rtc.regs[0x01] & 0x02) || !(rtc.regs[0x01] & 0x40))
+        return 0;
+    if(rtc.regs[0x0f] & 0x80)       //TAM: pulsed interrupt
+        return sim_time_us < rtc.pulse_end_us;
+    return 1;
+}
+
+//============================================================================
+// HDC1080
+//  * Registers are 16 bits, MSB first, selected by a pointer byte.
+//  * Writing the pointer 0x00 (or 0x01) with no data starts a conversion.
+//    Reading before the 6.35ms (14-bit) conversion time has passed is
+//    NACKed, just like the real part.
+//  * Temperature code = (T + 40) / 165 * 2^16.
+//============================================================================
+#define HDC_CONVERSION_US 6350
+
+static struct {
+    uint16_t regs[256];
+    uint8_t  ptr;
+    int      addressed;
+    int      nbytes;
+    uint16_t data;
+    int      converting;
+    uint64_t ready_us;
+} hdc;
+
+static void hdc_reset(sim_device_t *dev) {
+    memset(&hdc, 0, sizeof(hdc));
+    hdc.regs[0x02] = 0x1000;
+    hdc.regs[0xfe] = 0x5449;        //Manufacturer ID
+    hdc.regs[0xff] = 0x1050;        //Device ID
+}
+
+static int hdc_start(sim_device_t *dev, int read) {
+    hdc.addressed = read;
+    hdc.nbytes = 0;
+    if(read && hdc.converting && sim_time_us < hdc.ready_us)
+        return -1;                  //Conversion still in progress
+    if(read && hdc.converting) {
+        double t    = now_s();
+        double code = (sim_waveform(SIM_TEMP_C, t) + 40) / 165 * 65536;
+        if(code < 0)     code = 0;
+        if(code > 65535) code = 65535;
+        hdc.regs[0x00] = (uint16_t)code & 0xfffc;
+        hdc.converting = 0;
+    }
+    return 0;
+}
+
+static int hdc_write(sim_device_t *dev, uint8_t byte) {
+    if(!hdc.addressed) {
+        hdc.ptr = byte;
+        hdc.addressed = 1;
+        return 0;
+    }
+    hdc.data = (hdc.data << 8) | byte;
+    if(++hdc.nbytes == 2 && hdc.ptr == 0x02)
+        hdc.regs[0x02] = hdc.data & 0xff00;
+    return 0;
+}
+
+static uint8_t hdc_read(sim_device_t *dev) {
+    uint16_t val = hdc.regs[hdc.ptr];
+    return hdc.nbytes++ & 1 ? val & 0xff : val >> 8;
+}
+
+static void hdc_stop(sim_device_t *dev) {
+    if(hdc.addressed && hdc.nbytes == 0 && hdc.ptr <= 0x01 && !hdc.converting) {
+        hdc.converting = 1;
+        hdc.ready_us   = sim_time_us + HDC_CONVERSION_US;
+    }
+    hdc.addressed = 0;
+}
+
+static void hdc_advance(sim_device_t *dev, uint64_t now_us) {
+}
+
+//============================================================================
+// BUS
+//============================================================================
+static sim_device_t devices[] = {
+    { ACCELEROMETER_ADDR, mpu_start, mpu_write, mpu_read, mpu_stop, mpu_advance, mpu_reset },
+    { PULSEOX_ADDR,       ppg_start, ppg_write, ppg_read, ppg_stop, ppg_advance, ppg_reset },
+    { WATCH_ADDR,         rtc_start, rtc_write, rtc_read, rtc_stop, rtc_advance, rtc_reset },
+    { HDC_ADDR,           hdc_start, hdc_write, hdc_read, hdc_stop, hdc_advance, hdc_reset },
+};
+#define NUM_DEVICES (sizeof(devices)/sizeof(devices[0]))
+
+sim_device_t *sim_find_device(uint8_t addr) {
+    for(int i = 0; i < NUM_DEVICES; i++)
+        if(devices[i].addr == addr)
+            return &devices[i];
+    return 0;
+}
+
+void sim_init(void) {
+    sim_time_us = 0;
+    memset(&sim_i2c_stats, 0, sizeof(sim_i2c_stats));
+    for(int i = 0; i < NUM_DEVICES; i++)
+        devices[i].reset(&devices[i]);
+}
+
+void sim_advance(uint64_t us) {
+    sim_time_us += us;
+    for(int i = 0; i < NUM_DEVICES; i++)
+        devices[i].advance(&devices[i], sim_time_us);
+}
+
+void sim_nano_wait(unsigned int ns) {
+    sim_advance(ns / 1000);
+}
@@ -0,0 +1,191 @@
+/*****************************************************************************
+ * This code re-implements the I2C helper functions from i2c.h for the host  *
+ * simulation. Instead of driving I2C1 it hands each START, byte and STOP to *
+ * the device model at the addressed slot, and charges the bus time of the   *
+ * transfer to the simulated clock.                                          *
+ *****************************************************************************/
+#include "stm32f0xx.h"
+#include <stdio.h>
+#include "i2c.h"
+#include "sim.h"
+
+#define BYTE_US  90     //9 clocks per byte at 100kHz
+#define EDGE_US  10     //START/STOP setup and hold
+
+I2C_TypeDef     sim_i2c1;
+sim_i2c_stats_t sim_i2c_stats;
+
+static sim_device_t *active;
+
+//============================================================================
+// BUS_TIME
+//  * Charges the time of a bus segment to the simulated clock.
+//============================================================================
+static void bus_time(uint64_t us) {
+    sim_i2c_stats.bus_us += us;
+    sim_advance(us);
+}
+
+//============================================================================
+// SIM_START
+//  * Addresses a device. Returns -1 (NACK) if nothing answers at devaddr.
+//============================================================================
+static int sim_start(uint8_t devaddr, uint8_t dir) {
+    bus_time(EDGE_US + BYTE_US);
+    sim_i2c_stats.bytes++;
+    active = sim_find_device(devaddr);
+    if(active == 0 || active->start(active, dir)) {
+        sim_i2c_stats.nacks++;
+        return -1;
+    }
+    return 0;
+}
+
+static int sim_write(uint8_t byte) {
+    bus_time(BYTE_US);
+    sim_i2c_stats.bytes++;
+    if(active->write(active, byte)) {
+        sim_i2c_stats.nacks++;
+        return -1;
+    }
+    return 0;
+}
+
+static uint8_t sim_read(void) {
+    bus_time(BYTE_US);
+    sim_i2c_stats.bytes++;
+    sim_i2c1.RXDR = active->read(active);
+    return sim_i2c1.RXDR;
+}
+
+static void sim_stop(void) {
+    bus_time(EDGE_US);
+    if(active)
+        active->stop(active);
+    active = 0;
+    sim_i2c_stats.transactions++;
+}
+
+//============================================================================
+// INIT_I2C and low-level helpers
+//  * Nothing to configure on the host. The helpers exist so code that calls
+//    them directly still links.
+//============================================================================
+void init_i2c(void) {
+    sim_i2c1.ISR = 0;
+}
+
+void i2c_waitidle(void) {
+}
+
+void i2c_start(uint32_t devaddr, uint8_t size, uint8_t dir) {
+    sim_start(devaddr, dir);
+}
+
+void i2c_stop(void) {
+    sim_stop();
+}
+
+int i2c_checknack(void) {
+    return 0;
+}
+
+void i2c_clearnack(void) {
+}
+
+//============================================================================
+// I2C_SENDDATA
+//  * S DevAddrW Ack Data Ack ... P
+//============================================================================
+int i2c_senddata(uint8_t devaddr, const void *data, uint8_t size) {
+    if(size <= 0 || data == 0)
+        return -1;
+    const uint8_t *udata = (const uint8_t*)data;
+    if(sim_start(devaddr, 0)) {
+        sim_stop();
+        return -1;
+    }
+    for(int i = 0; i < size; i++) {
+        if(sim_write(udata[i])) {
+            sim_stop();
+            return -1;
+        }
+    }
+    sim_stop();
+    return 0;
+}
+
+//============================================================================
+// I2C_RECVDATA_P
+//  * S DevAddrR Ack Data Ack ... Data Nack P
+//============================================================================
+int i2c_recvdata_P(uint8_t devaddr, void *data, uint8_t size) {
+    if(size <= 0 || data == 0)
+        return -1;
+    uint8_t *udata = (uint8_t*)data;
+    if(sim_start(devaddr, 1)) {
+        sim_stop();
+        return -1;
+    }
+    for(int i = 0; i < size; i++)
+        udata[i] = sim_read();
+    sim_stop();
+    return 0;
+}
+
+//============================================================================
+// I2C_RECVDATA_NOP
+//  * S DevAddrW Ack Data[size] Ack S DevAddrR Ack Data[size] Nack P
+//  * Matches the hardware version: the same buffer is sent, then overwritten.
+//============================================================================
+int i2c_recvdata_noP(uint8_t devaddr, void *data, uint8_t size) {
+    if(size <= 0 || data == 0)
+        return -1;
+    uint8_t *udata = (uint8_t*)data;
+    if(sim_start(devaddr, 0)) {
+        sim_stop();
+        return -1;
+    }
+    for(int i = 0; i < size; i++) {
+        if(sim_write(udata[i])) {
+            sim_stop();
+            return -1;
+        }
+    }
+    bus_time(EDGE_US);                  //Repeated START
+    if(sim_start(devaddr, 1)) {
+        sim_stop();
+        return -1;
+    }
+    for(int i = 0; i < size; i++)
+        udata[i] = sim_read();
+    sim_stop();
+    return 0;
+}
+
+//============================================================================
+// I2C_RECVDATA_NOP_ARRAY
+//  * S DevAddrW Ack Reg Ack S DevAddrR Ack Data[size] Nack P
+//============================================================================
+int i2c_recvdata_noP_array(uint8_t devaddr, void *data, uint8_t size, void *reg) {
+    if(size <= 0 || data == 0 || reg == 0)
+        return -1;
+    uint8_t *udata = (uint8_t*)data;
+    if(sim_start(devaddr, 0)) {
+        sim_stop();
+        return -1;
+    }
+    if(sim_write(*(uint8_t*)reg)) {
+        sim_stop();
+        return -1;
+    }
+    bus_time(EDGE_US);                  //Repeated START
+    if(sim_start(devaddr, 1)) {
+        sim_stop();
+        return -1;
+    }
+    for(int i = 0; i < size; i++)
+        udata[i] = sim_read();
+    sim_stop();
+    return 0;
+}
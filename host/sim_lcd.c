@@ -0,0 +1,360 @@
+/*****************************************************************************
+ * This code models the hardware behind src/lcd_spi.c on a PC: SPI1, the     *
+ * LCD's pins on GPIOB and DMA1 channel 3 (see stm32f0xx.h). The bytes the   *
+ * driver writes, or has the DMA send, are decoded with the CS and D/C pins  *
+ * the way the ILI9341 does, into a model of the panel's 240x320 RAM: MADCTL *
+ * sets how the column and page addresses map onto RAM, CASET/PASET set the  *
+ * window, RAMWR starts writing at its corner and pixels fill it row by row, *
+ * and VSCRDEF/VSCRSADD scroll what is shown. sim_lcd_pixel() and            *
+ * sim_lcd_save_ppm() give the screen as it would be seen, for screenshots   *
+ * and golden-image comparisons.                                             *
+ *                                                                           *
+ * It also counts the traffic: command bytes, parameter bytes, pixel words,  *
+ * address window commands, bus drains and display selections, in total and  *
+ * (with sim_lcd_log()) for each drawing call. Anything the panel or the MCU *
+ * would not accept (a byte sent with CS high, a frame size other than 8 or  *
+ * 16 bits, a DMA channel not mapped to SPI1) ends the program with a        *
+ * message.                                                                  *
+ *****************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include "stm32f0xx.h"
+#include "lcd.h"
+#include "lcd_spi.h"
+#include "sim_lcd.h"
+
+sim_lcd_stats_t sim_lcd_stats;
+static sim_lcd_stats_t call_start;
+static FILE *call_log;
+static uint32_t idle;               //Register uses that changed nothing
+
+//Registers
+SPI_TypeDef         sim_spi1 = { .SR = SPI_SR_TXE };
+GPIO_TypeDef        sim_gpiob;
+DMA_TypeDef         sim_dma1;
+DMA_Channel_TypeDef sim_dma1_ch3;
+DMA_Request_TypeDef sim_dma1_cselr;
+
+#define CS_PIN    (1 << 8)
+#define RESET_PIN (1 << 11)
+#define DC_PIN    (1 << 14)
+
+//Panel state
+static u16 ram[LCD_H][LCD_W];       //RAM rows (gate lines) by columns
+static u8  madctl;
+static u16 sc, ec, sp, ep;          //Window: columns and pages
+static u16 cur_c, cur_p;            //Write pointer
+static u16 tfa, vsa = LCD_H, vsp;   //Scrolling
+static u8  cmd, nparam, param[6];
+static int half = -1;               //First byte of a pixel
+
+#define MADCTL_MY 0x80
+#define MADCTL_MX 0x40
+#define MADCTL_MV 0x20
+
+uint32_t sim_lcd_bytes(const sim_lcd_stats_t *st) {
+    return st->commands + st->params + 2*st->pixels;
+}
+
+//============================================================================
+// RAM_ADDR
+//  * Where the column/page address pair (c,p) lands in RAM. MV exchanges
+//    the two; MY and MX then reverse the RAM rows and columns. Rotation 1
+//    (MX|MV) so puts screen x along the RAM rows, as lcd.c assumes for
+//    scrolling.
+//============================================================================
+static void ram_addr(int c, int p, int *row, int *col) {
+    int r = madctl & MADCTL_MV ? c : p;
+    int k = madctl & MADCTL_MV ? p : c;
+    *row = madctl & MADCTL_MY ? LCD_H - 1 - r : r;
+    *col = madctl & MADCTL_MX ? LCD_W - 1 - k : k;
+}
+
+static void command(uint8_t c) {
+    cmd = c;
+    nparam = 0;
+    sim_lcd_stats.commands++;
+    if(c == 0x2A || c == 0x2B)
+        sim_lcd_stats.windows++;
+    if(c == 0x2C) {     //RAMWR
+        cur_c = sc;
+        cur_p = sp;
+    }
+}
+
+static void parameter(uint8_t b) {
+    sim_lcd_stats.params++;
+    if(nparam < sizeof(param))
+        param[nparam++] = b;
+    switch(cmd) {
+    case 0x2A:
+        if(nparam == 4) {
+            sc = param[0] << 8 | param[1];
+            ec = param[2] << 8 | param[3];
+        }
+        break;
+    case 0x2B:
+        if(nparam == 4) {
+            sp = param[0] << 8 | param[1];
+            ep = param[2] << 8 | param[3];
+        }
+        break;
+    case 0x33:
+        if(nparam == 6) {
+            tfa = param[0] << 8 | param[1];
+            vsa = param[2] << 8 | param[3];
+        }
+        break;
+    case 0x36:
+        madctl = b;
+        break;
+    case 0x37:
+        if(nparam == 2)
+            vsp = param[0] << 8 | param[1];
+        break;
+    }
+}
+
+//Past the end of the window the panel starts again at its corner.
+static void pixel(u16 c) {
+    sim_lcd_stats.pixels++;
+    int row, col;
+    ram_addr(cur_c, cur_p, &row, &col);
+    if(row >= 0 && row < LCD_H && col >= 0 && col < LCD_W)
+        ram[row][col] = c;
+    if(++cur_c > ec) {
+        cur_c = sc;
+        if(++cur_p > ep)
+            cur_p = sp;
+    }
+}
+
+//============================================================================
+// SIM_LCD_PIXEL
+//  * The colour seen at screen position (x,y). Inside the scrolling area,
+//    gate line TFA+i shows RAM row TFA + (VSP-TFA+i) mod VSA.
+//============================================================================
+u16 sim_lcd_pixel(int x, int y) {
+    sim_lcd_sync();
+    int row, col;
+    ram_addr(x, y, &row, &col);
+    if(row >= tfa && row < tfa + vsa && vsa)
+        row = tfa + (row - tfa + vsp - tfa + vsa) % vsa;
+    return ram[row][col];
+}
+
+int sim_lcd_save_ppm(const char *name) {
+    FILE *f = fopen(name, "wb");
+    if(!f)
+        return -1;
+    fprintf(f, "P6\n%d %d\n255\n", lcddev.width, lcddev.height);
+    for(int y = 0; y < lcddev.height; y++)
+        for(int x = 0; x < lcddev.width; x++) {
+            u16 c = sim_lcd_pixel(x, y);
+            fputc((c >> 11) * 255 / 31, f);
+            fputc((c >> 5 & 63) * 255 / 63, f);
+            fputc((c & 31) * 255 / 31, f);
+        }
+    fclose(f);
+    return 0;
+}
+
+void sim_lcd_log(FILE *f) {
+    call_log = f;
+}
+
+static void fail(const char *why) {
+    fprintf(stderr, "sim_lcd: %s\n", why);
+    exit(1);
+}
+
+//============================================================================
+// SELECT_START / SELECT_END
+//  * CS going low starts a drawing call, and going high ends it. With a
+//    log, each call's traffic is printed when it ends.
+//============================================================================
+static void select_start(void) {
+    sim_lcd_stats.selects++;
+    call_start = sim_lcd_stats;
+}
+
+static void select_end(void) {
+    if(!call_log)
+        return;
+    sim_lcd_stats_t d;
+    d.commands = sim_lcd_stats.commands - call_start.commands;
+    d.params   = sim_lcd_stats.params   - call_start.params;
+    d.pixels   = sim_lcd_stats.pixels   - call_start.pixels;
+    fprintf(call_log, "call %u: %u cmds, %u params, %u pixels, %u windows, %u bytes\n",
+            sim_lcd_stats.selects, d.commands, d.params, d.pixels,
+            sim_lcd_stats.windows - call_start.windows, sim_lcd_bytes(&d));
+}
+
+static void reset(void) {  //Hardware reset defaults
+    madctl = 0;
+    tfa = vsp = 0;
+    vsa = LCD_H;
+}
+
+//============================================================================
+// FRAME
+//  * One byte on the bus, taken as the panel takes it: a command with D/C
+//    low, otherwise a parameter, or half a pixel after RAMWR. The panel
+//    would not hear a byte sent with CS high, so that ends the program.
+//============================================================================
+static void frame(uint8_t b) {
+    if(sim_gpiob.ODR & CS_PIN)
+        fail("byte sent with the display not selected");
+    if(!(sim_gpiob.ODR & DC_PIN)) {
+        command(b);
+        half = -1;
+    } else if(cmd == 0x2C) {
+        if(half < 0)
+            half = b;
+        else {
+            pixel(half << 8 | b);
+            half = -1;
+        }
+    } else
+        parameter(b);
+}
+
+//The frame size is DS+1 bits; values under 4 are not allowed and give 8.
+static int frame16(void) {
+    int ds = (sim_spi1.CR2 & SPI_CR2_DS) >> 8;
+    if(ds == 0xF)
+        return 1;
+    if(ds != 0x7 && ds > 2)
+        fail("SPI frame size is neither 8 nor 16 bits");
+    return 0;
+}
+
+//A 16-bit write in 8-bit mode packs two frames, low byte first.
+static void word(uint16_t w) {
+    if(frame16()) {
+        frame(w >> 8);
+        frame(w);
+    } else {
+        frame(w);
+        frame(w >> 8);
+    }
+}
+
+void sim_spi_write8(uint8_t data) {
+    sim_lcd_sync();
+    idle = 0;
+    if(frame16())
+        fail("8-bit write to the FIFO in 16-bit mode");
+    frame(data);
+}
+
+void sim_spi_write16(uint16_t data) {
+    sim_lcd_sync();
+    idle = 0;
+    word(data);
+}
+
+void sim_spi_drain(void) {
+    sim_lcd_sync();
+    sim_lcd_stats.drains++;
+}
+
+//============================================================================
+// DMA_RUN
+//  * Sends what DMA1 channel 3 has been set up to send, all at once, and
+//    flags it complete. It runs at the first use of a register after it was
+//    enabled, so a source buffer changed before then shows up as wrong
+//    pixels.
+//============================================================================
+extern char __executable_start[], _end[];
+
+static int dma_run(void) {
+    DMA_Channel_TypeDef *ch = &sim_dma1_ch3;
+    if(!(ch->CCR & DMA_CCR_EN) || !ch->CNDTR || !(sim_spi1.CR2 & SPI_CR2_TXDMAEN))
+        return 0;
+    if((sim_dma1_cselr.CSELR & DMA_CSELR_C3S) != DMA1_CSELR_CH3_SPI1_TX)
+        fail("DMA1 channel 3 is not mapped to SPI1_TX");
+    if(ch->CPAR != (uint32_t)(uintptr_t)&sim_spi1.DR || !(ch->CCR & DMA_CCR_DIR))
+        fail("DMA1 channel 3 does not write SPI1->DR");
+    if((ch->CCR & (DMA_CCR_MSIZE | DMA_CCR_PSIZE)) != (DMA_CCR_MSIZE_0 | DMA_CCR_PSIZE_0))
+        fail("DMA1 channel 3 is not set up for 16-bit words");
+    const uint16_t *src = (const uint16_t *)(uintptr_t)ch->CMAR;
+    uint32_t n = ch->CNDTR;
+    if((const char *)src < __executable_start
+       || (const char *)(src + (ch->CCR & DMA_CCR_MINC ? n : 1)) > _end)
+        fail("DMA source is not static memory (link with -no-pie)");
+    while(n--) {
+        word(*src);
+        if(ch->CCR & DMA_CCR_MINC)
+            src++;
+    }
+    ch->CNDTR = 0;
+    sim_dma1.ISR |= DMA_ISR_GIF3 | DMA_ISR_TCIF3;
+    return 1;
+}
+
+//============================================================================
+// SIM_LCD_SYNC
+//  * Called on every use of SPI1, GPIOB, DMA1 or the NVIC (see stm32f0xx.h),
+//    before it. Applies what the driver wrote since the last call to BSRR,
+//    IFCR and ICER, runs an enabled transfer, and takes the DMA interrupt
+//    if it is pending and enabled, as it would be taken between two
+//    statements of the driver.
+//  * The driver only ever loops on a register when something is wrong (the
+//    display selected twice, or a wait for a transfer that never started),
+//    so a long run of calls that change nothing ends the program.
+//============================================================================
+void DMA1_Ch2_3_DMA2_Ch1_2_IRQHandler(void);
+
+static int apply(void) {
+    int busy = 0;
+    if(sim_nvic.ICER[0]) {
+        sim_nvic.ISER[0] &= ~sim_nvic.ICER[0];
+        sim_nvic.ICER[0]  = 0;
+        busy = 1;
+    }
+    if(sim_gpiob.BSRR) {
+        uint32_t was = sim_gpiob.ODR;
+        uint32_t now = (was & ~(sim_gpiob.BSRR >> 16)) | (sim_gpiob.BSRR & 0xffff);
+        sim_gpiob.ODR  = now;
+        sim_gpiob.BSRR = 0;
+        if((was & CS_PIN) && !(now & CS_PIN))
+            select_start();
+        if(!(was & CS_PIN) && (now & CS_PIN))
+            select_end();
+        if((was & RESET_PIN) && !(now & RESET_PIN))
+            reset();
+        busy = 1;
+    }
+    if(sim_dma1.IFCR) {
+        if(sim_dma1.IFCR & DMA_IFCR_CGIF3)
+            sim_dma1.ISR &= ~0x00000f00;
+        sim_dma1.IFCR = 0;
+        busy = 1;
+    }
+    return dma_run() || busy;
+}
+
+void sim_lcd_sync(void) {
+    static int in_irq;
+    int busy = apply();
+    while(!in_irq && (sim_dma1.ISR & DMA_ISR_TCIF3)
+          && (sim_dma1_ch3.CCR & DMA_CCR_TCIE)
+          && (sim_nvic.ISER[0] & 1 << DMA1_Ch2_3_DMA2_Ch1_2_IRQn)) {
+        in_irq = 1;
+        DMA1_Ch2_3_DMA2_Ch1_2_IRQHandler();
+        in_irq = 0;
+        apply();
+        busy = 1;
+    }
+    if(busy)
+        idle = 0;
+    else if(++idle > 1000000)
+        fail("driver stuck: display selected twice, or waiting on a transfer that never started");
+}
+
+//The pins as init_lcd_spi() leaves them: CS and nRESET high, 8-bit frames.
+void init_lcd_spi(void) {
+    sim_gpiob.ODR |= CS_PIN | RESET_PIN;
+    sim_spi1.CR2   = 0x0700;
+}
@@ -0,0 +1,31 @@
+/*****************************************************************************
+ * This header gives the host-side model of the hardware behind the LCD      *
+ * driver. sim_lcd.c stands in for SPI1, GPIOB and DMA1, so src/lcd.c and    *
+ * src/lcd_spi.c run unmodified on a PC against a model of the panel: it     *
+ * renders into the panel's RAM, which can be read back or saved as a PPM    *
+ * screenshot, and counts the traffic that was sent.                         *
+ *****************************************************************************/
+#ifndef __SIM_LCD_H
+#define __SIM_LCD_H
+#include <stdio.h>
+#include <stdint.h>
+
+#define SIM_LCD_SPI_HZ 24000000     //SPI1 at PCLK/2
+
+typedef struct {
+    uint32_t commands;      //Command bytes (D/C low)
+    uint32_t params;        //8-bit parameter bytes
+    uint32_t pixels;        //16-bit pixel words
+    uint32_t windows;       //Column/page address commands
+    uint32_t drains;        //Waits for the bus to go idle
+    uint32_t selects;       //Times the display was selected
+} sim_lcd_stats_t;
+
+extern sim_lcd_stats_t sim_lcd_stats;
+
+void     sim_lcd_sync(void);                        //Finish what was started
+uint32_t sim_lcd_bytes(const sim_lcd_stats_t *st);  //Total bytes on SPI
+uint16_t sim_lcd_pixel(int x, int y);               //As seen on the screen
+int      sim_lcd_save_ppm(const char *name);        //-1 if it cannot be written
+void     sim_lcd_log(FILE *f);                      //Traffic of each drawing call
+#endif
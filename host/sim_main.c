@@ -0,0 +1,192 @@
+/*****************************************************************************
+ * This code runs the unmodified sensor drivers and accelerometer algorithms *
+ * on a PC against the simulated I2C bus. It performs the same 30Hz sampling *
+ * schedule as the sample task in main.c and reports the results and the     *
+ * bus time spent per tick, so changes to the drivers or algorithms can be   *
+ * benchmarked and regression-checked without a board.                       *
+ * TIM14 is ticked from simulated time, running fast or slow by the HSI      *
+ * error given with -d, to exercise the MCU clock's drift tracking.          *
+ *                                                                           *
+ * Usage: watch_sim [-s seconds] [-w recording.csv] [-d hsi_ppm] [-v]        *
+ *****************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "sim.h"
+#include "i2c.h"
+#include "rtc.h"
+#include "sensors.h"
+#include "accelerometer_algorithms.h"
+#include "bus_scheduler.h"
+#include "clock.h"
+#include "history.h"
+
+#define TICK_US 33333   //30Hz
+
+static int spo2, HR, tempF, steps, EE_a, hour, minute;
+
+TIM_TypeDef sim_tim14;
+RCC_TypeDef sim_rcc;
+NVIC_Type   sim_nvic;
+void TIM14_IRQHandler(void);
+
+//============================================================================
+// TIM14_RUN
+//  * Raises every TIM14 update due by now and runs its interrupt. The timer
+//    counts at 48MHz/(PSC+1) from an HSI that is off by hsi_ppm.
+//============================================================================
+static double tim14_next_us;
+
+static void tim14_run(double hsi_ppm) {
+    if(!(TIM14->CR1 & TIM_CR1_CEN))
+        return;
+    while(sim_time_us >= tim14_next_us) {
+        tim14_next_us += (TIM14->PSC + 1) * (TIM14->ARR + 1) / 48.0
+                       / (1 + hsi_ppm/1e6);
+        TIM14->SR |= TIM_SR_UIF;
+        TIM14_IRQHandler();
+    }
+}
+
+//Same slots and bus schedule as main.c
+static void sample_pulseox(void) {
+    pulseox_check();
+    spo2 = get_spo2();
+    HR   = get_HR((uint32_t)sim_time_us);
+}
+
+static void sample_accel(void) {
+    accel_sample();
+    if(detect_step())
+        steps++;
+}
+
+static void sample_temp(void) {
+    int t = temp_fetch();
+    if(t != -1)
+        tempF = t;
+    temp_trigger();
+}
+
+static void sample_time(void) {
+    clock_sync();
+}
+
+static void read_clock(void) {
+    watch_datetime_t now;
+    clock_now(&now);
+    hour   = now.hour;
+    minute = now.minutes;
+}
+
+static void new_day(const watch_datetime_t *ended) {
+    day_record_t rec;
+    rec.day         = ended->day;
+    rec.month       = ended->month;
+    rec.year        = ended->year;
+    rec.steps       = steps;
+    rec.EE          = EE_a;
+    rec.EE_exercise = EE_new_day();
+    history_add(&rec);
+    steps = 0;
+    EE_a  = 0;
+}
+
+static bus_slot_t bus_slots[] = {
+    { "pulseox", sample_pulseox, BUS_RATE_HZ(30), 0, 0, 2*I2C_XFER_US(4) + I2C_XFER_US(9) },
+    { "accel",   sample_accel,   BUS_RATE_HZ(30), 0, 1, 6*I2C_XFER_US(4)                  },
+    { "temp",    sample_temp,    BUS_RATE_HZ(1),  0, 2, I2C_XFER_US(2) + I2C_XFER_US(3)   },
+    { "time",    sample_time,    BUS_EVERY_S(60), 0, 3, I2C_XFER_US(10)                   },
+};
+
+int main(int argc, char **argv) {
+    int seconds = 120;
+    int verbose = 0;
+    double hsi_ppm = 0;
+    sim_init();
+    for(int a = 1; a < argc; a++) {
+        if(!strcmp(argv[a], "-s") && a + 1 < argc)
+            seconds = atoi(argv[++a]);
+        else if(!strcmp(argv[a], "-w") && a + 1 < argc) {
+            if(sim_waveform_load(argv[++a]) < 0) {
+                fprintf(stderr, "Cannot load waveform %s\n", argv[a]);
+                return 1;
+            }
+        } else if(!strcmp(argv[a], "-d") && a + 1 < argc)
+            hsi_ppm = atof(argv[++a]);
+        else if(!strcmp(argv[a], "-v"))
+            verbose = 1;
+        else {
+            fprintf(stderr, "Usage: %s [-s seconds] [-w recording.csv] [-d hsi_ppm] [-v]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    //Same bring-up order as main()
+    init_i2c();
+    pulseox_setup();
+    init_temp_sensor();
+    init_accelerometer();
+    init_watch();
+    sim_set_datetime(2022, 12, 5, 1, 23, 58, 0);
+    clock_on_new_day(new_day);
+    init_clock();
+    tim14_next_us = sim_time_us;
+    tim14_run(hsi_ppm);
+    read_clock();
+    bus_sched_init(bus_slots, sizeof(bus_slots)/sizeof(bus_slots[0]), 5000);
+
+    int ticks = seconds*30;
+    int overruns = 0;
+    uint64_t worst_us = 0;
+    clock_t host_start = clock();
+
+    for(int i = 0; i < ticks; i++) {
+        tim14_run(hsi_ppm);
+        uint64_t tick_start = sim_time_us;
+
+        bus_sched_tick();
+        read_clock();
+        if(i % (30*60) == 30*60 - 1)
+            EE_a = EE_IEEE(125);
+
+        uint64_t spent = sim_time_us - tick_start;
+        if(spent > worst_us)
+            worst_us = spent;
+        if(spent > TICK_US)
+            overruns++;
+        else
+            sim_advance(TICK_US - spent);
+
+        if(verbose && i % 30 == 0)
+            printf("%02d:%02d  SpO2 %3d  HR %3d  Temp %d.%dF  Steps %d\n",
+                   hour, minute, spo2, HR, tempF/10, tempF%10, steps);
+    }
+    double host_s = (double)(clock() - host_start) / CLOCKS_PER_SEC;
+    const clock_stats_t *cs = clock_get_stats();
+
+    printf("simulated  %d s (%d ticks)\n", seconds, ticks);
+    printf("time       %02d:%02d\n", hour, minute);
+    printf("spo2       %d\n", spo2);
+    printf("hr         %d\n", HR);
+    printf("temp       %d.%dF\n", tempF/10, tempF%10);
+    printf("steps      %d\n", steps);
+    printf("ee         %d.%02d\n", EE_a/100, abs(EE_a%100));
+    printf("i2c        %u transactions, %u bytes, %u nacks\n",
+           sim_i2c_stats.transactions, sim_i2c_stats.bytes, sim_i2c_stats.nacks);
+    printf("bus time   %.1f us/tick average\n", (double)sim_i2c_stats.bus_us / ticks);
+    printf("tick time  %llu us worst, %d overruns\n",
+           (unsigned long long)worst_us, overruns);
+    printf("clock      %u syncs, %u steps, last error %d s, trim %ld ppm\n",
+           cs->syncs, cs->steps, cs->last_err_s, (long)cs->trim_ppm);
+    for(int d = 1; d <= history_count(); d++) {
+        day_record_t rec;
+        history_get(d, &rec);
+        printf("history    %02d/%02d/%02d  %ld steps, EE %ld.%02ld\n",
+               rec.month, rec.day, rec.year, (long)rec.steps,
+               (long)rec.EE/100, labs((long)rec.EE%100));
+    }
+    printf("host       %.0f ticks/s\n", host_s > 0 ? ticks / host_s : 0);
+    return 0;
+}
@@ -0,0 +1,108 @@
+/*****************************************************************************
+ * This code supplies the physical inputs of the simulated sensors. A        *
+ * waveform is either scripted (a C function of time) or recorded (a CSV     *
+ * file with one row per sample time). Recorded files use the columns        *
+ *     t_s, accel_x_g, accel_y_g, accel_z_g, ppg_red, ppg_ir, temp_c         *
+ * Lines that do not start with a number (headers, comments) are skipped.    *
+ * Values between rows are linearly interpolated; the last row is held.      *
+ *****************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "sim.h"
+
+#define PI 3.14159265358979
+
+typedef struct {
+    double t;
+    double v[SIM_CHANNELS];
+} sim_row_t;
+
+static sim_script_t script = sim_walk_script;
+static sim_row_t   *rows;
+static int          nrows;
+
+//============================================================================
+// SIM_WALK_SCRIPT
+//  * Wrist of someone walking at 1.8 steps/s with a 72BPM pulse and a skin
+//    temperature of 33C. The PPG pulse has a sharp systolic upstroke so the
+//    peak detector in get_HR() has something realistic to find.
+//============================================================================
+double sim_walk_script(int channel, double t) {
+    double step  = sin(2*PI*1.8*t);
+    double beat  = fmod(t*1.2, 1.0);                        //72BPM phase
+    double pulse = beat < 0.15 ? beat/0.15 : exp(-(beat-0.15)*4);
+    switch(channel) {
+    case SIM_ACCEL_X: return 0.05*sin(2*PI*0.9*t);
+    case SIM_ACCEL_Y: return 0.10*step;
+    case SIM_ACCEL_Z: return 1.0 + 0.35*step;
+    case SIM_PPG_RED: return 60000 + 600*pulse;
+    case SIM_PPG_IR:  return 80000 + 900*pulse;
+    case SIM_TEMP_C:  return 33.0 + 0.2*sin(2*PI*t/600);
+    }
+    return 0;
+}
+
+void sim_waveform_script(sim_script_t s) {
+    free(rows);
+    rows   = 0;
+    nrows  = 0;
+    script = s;
+}
+
+//============================================================================
+// SIM_WAVEFORM_LOAD
+//  * Loads a recorded waveform. Returns the number of rows, or -1.
+//============================================================================
+int sim_waveform_load(const char *path) {
+    FILE *f = fopen(path, "r");
+    if(f == 0)
+        return -1;
+    char line[256];
+    int  cap = 0;
+    sim_waveform_script(0);
+    while(fgets(line, sizeof(line), f)) {
+        sim_row_t row;
+        if(sscanf(line, "%lf,%lf,%lf,%lf,%lf,%lf,%lf", &row.t,
+                  &row.v[SIM_ACCEL_X], &row.v[SIM_ACCEL_Y], &row.v[SIM_ACCEL_Z],
+                  &row.v[SIM_PPG_RED], &row.v[SIM_PPG_IR],
+                  &row.v[SIM_TEMP_C]) != 7)
+            continue;
+        if(nrows == cap) {
+            cap  = cap ? cap*2 : 1024;
+            rows = realloc(rows, cap*sizeof(sim_row_t));
+        }
+        rows[nrows++] = row;
+    }
+    fclose(f);
+    if(nrows == 0) {
+        script = sim_walk_script;
+        return -1;
+    }
+    return nrows;
+}
+
+//============================================================================
+// SIM_WAVEFORM
+//  * Value of a channel at time t (seconds).
+//============================================================================
+double sim_waveform(int channel, double t) {
+    if(rows == 0)
+        return script(channel, t);
+
+    //Binary search for the last row at or before t
+    int lo = 0, hi = nrows - 1;
+    if(t <= rows[0].t)
+        return rows[0].v[channel];
+    if(t >= rows[hi].t)
+        return rows[hi].v[channel];
+    while(hi - lo > 1) {
+        int mid = (lo + hi)/2;
+        if(rows[mid].t <= t)
+            lo = mid;
+        else
+            hi = mid;
+    }
+    double f = (t - rows[lo].t)/(rows[hi].t - rows[lo].t);
+    return rows[lo].v[channel] + f*(rows[hi].v[channel] - rows[lo].v[channel]);
+}
@@ -0,0 +1,162 @@
+/*****************************************************************************
+ * This header stands in for the STM32F0 device header when the driver and   *
+ * algorithm code is compiled on a PC (see sim.h). It only declares the      *
+ * peripheral registers that the drivers touch directly after a transfer     *
+ * (I2C1->RXDR) and those of TIM14, which sim_main.c ticks to drive the MCU  *
+ * clock; every bus transaction itself goes through sim_i2c.c.               *
+ *                                                                           *
+ * For the LCD's SPI driver (src/lcd_spi.c) it also declares SPI1, GPIOB and *
+ * DMA1, which sim_lcd.c models. Every use of one of them, or of the NVIC,   *
+ * first lets the model act on what the driver last wrote: a pin set or      *
+ * reset through BSRR, a flag cleared through IFCR, an interrupt disabled    *
+ * through ICER, or a DMA transfer enabled.                                  *
+ *****************************************************************************/
+#ifndef __HOST_STM32F0XX_H
+#define __HOST_STM32F0XX_H
+#include <stdint.h>
+
+#define __IO volatile
+
+typedef struct {
+    __IO uint32_t CR1;
+    __IO uint32_t CR2;
+    __IO uint32_t OAR1;
+    __IO uint32_t OAR2;
+    __IO uint32_t TIMINGR;
+    __IO uint32_t TIMEOUTR;
+    __IO uint32_t ISR;
+    __IO uint32_t ICR;
+    __IO uint32_t PECR;
+    __IO uint32_t RXDR;
+    __IO uint32_t TXDR;
+} I2C_TypeDef;
+
+extern I2C_TypeDef sim_i2c1;   //Defined in sim_i2c.c
+#define I2C1 (&sim_i2c1)
+
+typedef struct {
+    __IO uint32_t CR1;
+    __IO uint32_t DIER;
+    __IO uint32_t SR;
+    __IO uint32_t PSC;
+    __IO uint32_t ARR;
+    __IO uint32_t CNT;
+} TIM_TypeDef;
+
+typedef struct {
+    __IO uint32_t AHBENR;
+    __IO uint32_t APB1ENR;
+} RCC_TypeDef;
+
+typedef struct {
+    __IO uint32_t ISER[1];
+    __IO uint32_t ICER[1];
+} NVIC_Type;
+
+extern TIM_TypeDef sim_tim14;  //Defined in sim_main.c
+extern RCC_TypeDef sim_rcc;    //Defined in sim_main.c and lcd_bench.c
+extern NVIC_Type   sim_nvic;
+#define TIM14 (&sim_tim14)
+#define RCC   (&sim_rcc)
+
+//The LCD model (sim_lcd.c, below) decides when the DMA interrupt is taken,
+//so it has to see each use of the NVIC too. Without it the NVIC is memory.
+void sim_lcd_sync(void) __attribute__((weak));
+#define NVIC  ((sim_lcd_sync ? sim_lcd_sync() : (void)0), &sim_nvic)
+
+#define RCC_APB1ENR_TIM14EN 0x00000100
+#define TIM_CR1_CEN         0x0001
+#define TIM_DIER_UIE        0x0001
+#define TIM_SR_UIF          0x0001
+#define TIM14_IRQn          19
+
+typedef struct {
+    __IO uint32_t CR1;
+    __IO uint32_t CR2;
+    __IO uint32_t SR;
+    __IO uint32_t DR;
+} SPI_TypeDef;
+
+typedef struct {
+    __IO uint32_t ODR;
+    __IO uint32_t BSRR;
+} GPIO_TypeDef;
+
+typedef struct {
+    __IO uint32_t ISR;
+    __IO uint32_t IFCR;
+} DMA_TypeDef;
+
+typedef struct {
+    __IO uint32_t CCR;
+    __IO uint32_t CNDTR;
+    __IO uint32_t CPAR;
+    __IO uint32_t CMAR;
+} DMA_Channel_TypeDef;
+
+typedef struct {
+    __IO uint32_t CSELR;
+} DMA_Request_TypeDef;
+
+extern SPI_TypeDef         sim_spi1;        //Defined in sim_lcd.c
+extern GPIO_TypeDef        sim_gpiob;
+extern DMA_TypeDef         sim_dma1;
+extern DMA_Channel_TypeDef sim_dma1_ch3;
+extern DMA_Request_TypeDef sim_dma1_cselr;
+#define SPI1          (sim_lcd_sync(), &sim_spi1)
+#define GPIOB         (sim_lcd_sync(), &sim_gpiob)
+#define DMA1          (sim_lcd_sync(), &sim_dma1)
+#define DMA1_Channel3 (sim_lcd_sync(), &sim_dma1_ch3)
+#define DMA1_CSELR    (sim_lcd_sync(), &sim_dma1_cselr)
+
+#define RCC_AHBENR_DMA1EN   0x00000001
+#define SPI_CR2_TXDMAEN     0x0002
+#define SPI_CR2_DS          0x0F00
+#define SPI_SR_TXE          0x0002
+#define SPI_SR_BSY          0x0080
+#define GPIO_BSRR_BS_8      0x00000100
+#define GPIO_BSRR_BS_11     0x00000800
+#define GPIO_BSRR_BS_14     0x00004000
+#define GPIO_BSRR_BR_8      0x01000000
+#define GPIO_BSRR_BR_11     0x08000000
+#define GPIO_BSRR_BR_14     0x40000000
+#define DMA_ISR_GIF3        0x00000100
+#define DMA_ISR_TCIF3       0x00000200
+#define DMA_IFCR_CGIF3      0x00000100
+#define DMA_CCR_EN          0x0001
+#define DMA_CCR_TCIE        0x0002
+#define DMA_CCR_DIR         0x0010
+#define DMA_CCR_MINC        0x0080
+#define DMA_CCR_PSIZE       0x0300
+#define DMA_CCR_PSIZE_0     0x0100
+#define DMA_CCR_MSIZE       0x0C00
+#define DMA_CCR_MSIZE_0     0x0400
+#define DMA_CSELR_C3S       0x00000F00
+#define DMA1_CSELR_CH3_SPI1_TX 0x00000300
+#define DMA1_Ch2_3_DMA2_Ch1_2_IRQn 10
+
+//The DMA address registers are 32 bits, as on the MCU. lcd_bench is linked
+//with -no-pie so that the static buffers and pictures the DMA reads from
+//have 32-bit addresses; sim_lcd.c checks that they do.
+#pragma GCC diagnostic ignored "-Wpointer-to-int-cast"
+
+//The host code runs in one thread, so there is nothing to mask.
+#define __disable_irq()
+#define __enable_irq()
+
+//On the host the nano_wait() busy loop is replaced by letting simulated
+//time pass. Each source defines its own nano_wait() in inline assembly,
+//and must wrap it in #ifndef nano_wait so this one is used instead.
+void sim_nano_wait(unsigned int ns);
+#define nano_wait sim_nano_wait
+
+//Likewise src/lcd_spi.c writes the SPI FIFO and waits for the bus to go
+//idle only through these, so sim_lcd.c sees every byte and word.
+void sim_spi_write8(uint8_t data);
+void sim_spi_write16(uint16_t data);
+void sim_spi_drain(void);
+#define spi_write8  sim_spi_write8
+#define spi_write16 sim_spi_write16
+#define spi_drain   sim_spi_drain
+
+#endif
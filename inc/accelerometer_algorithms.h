@@ -4,8 +4,7 @@
  * calculate BMR from user height/weight/age/sex to calculate TOTAL energy   *
  * expenditure.																 *
  * TO-DO:																     *
- * 	(1) Add functions that reset counters at midnight					     *
- * 	(2) Add functions to return 2-decimal approximations to main for display *
+ * 	(1) Add functions to return 2-decimal approximations to main for display *
  *****************************************************************************/
 #include "stm32f0xx.h"
 #include "i2c.h"
@@ -19,4 +18,4 @@ int BMR(int weight, int height, int age, char sex);	//Calculate BMR
 int EE_IEEE(int weight);							//Find Energy Expended, return EE as int (saves last two decimals)
 void start_exercising(void);						//Sets an exercising "boolean" to true
 void end_exercising(void);							//Sets an exercising "boolean" to false
-int midnight();				//Resets EE counters and returns a 1 if midnight
+int EE_new_day(void);								//Resets EE counters, returns the day's exercise EE*100
@@ -0,0 +1,29 @@
+/*****************************************************************************
+ * This header gives the I2C bus scheduler used by the 30Hz sampling tick.   *
+ * Each sensor is described by a slot: how often it is sampled, on which     *
+ * tick of its period, how important it is and how much bus time one sample  *
+ * costs. At startup the scheduler moves slots to other phases so no tick    *
+ * needs more bus time than the budget, then reports the worst tick.         *
+ *****************************************************************************/
+#ifndef __BUS_SCHEDULER_H
+#define __BUS_SCHEDULER_H
+#include "stm32f0xx.h"
+
+#define BUS_TICK_HZ         30
+#define BUS_RATE_HZ(hz)     (BUS_TICK_HZ / (hz))    //Period for a rate in Hz
+#define BUS_EVERY_S(s)      (BUS_TICK_HZ * (s))     //Period for one per s seconds
+#define I2C_XFER_US(bytes)  ((bytes)*90 + 20)       //100kHz, incl. address bytes
+
+typedef struct {
+    const char *name;
+    void     (*sample)(void);
+    uint16_t period;    //Ticks between samples
+    uint16_t phase;     //Tick within the period (may be moved at startup)
+    uint8_t  priority;  //0 is the most important
+    uint16_t cost_us;   //Bus time of one sample
+} bus_slot_t;
+
+void     bus_sched_init(bus_slot_t *slots, int n, uint32_t budget_us);
+void     bus_sched_tick(void);        //Run the slots due on this tick
+uint32_t bus_sched_worst_us(void);    //Worst-case bus time of any tick
+#endif
@@ -0,0 +1,38 @@
+/*****************************************************************************
+ * This header gives the strip chart: a band of screen columns showing the   *
+ * recent history of a few values, one column per sample with the newest on  *
+ * the right. It moves with the panel's hardware scrolling, so adding a      *
+ * sample draws one column however long the history is. The panel has one    *
+ * scrolling band, so there is one chart.                                    *
+ *****************************************************************************/
+#ifndef __CHART_H
+#define __CHART_H
+#include "stm32f0xx.h"
+#include "lcd.h"
+
+#define CHART_TRACES  2
+#define CHART_GRID    4
+#define CHART_COLUMNS 64            //Widest band
+#define CHART_NONE    INT16_MIN     //No sample: a gap in the trace
+
+typedef struct {
+    u16     y0, y1;         //Rows of the trace, top to bottom
+    int16_t lo, hi;         //Values drawn at the bottom and top rows
+    u16     c;
+} chart_trace_t;
+
+typedef struct {
+    u16 x0, x1;             //The band; the whole height of it scrolls
+    u16 y0, y1;             //Rows drawn per column; the rest must be plain
+    u16 bg;
+    const lcd_run_t *grid;  //Drawn in every column, under the traces
+    int ngrid;
+    int ntraces;
+    chart_trace_t trace[CHART_TRACES];
+} chart_cfg_t;
+
+void chart_init(const chart_cfg_t *cfg);    //Empty chart; draws nothing
+void chart_add(const int16_t *values);      //One value per trace
+void chart_draw_all(void);                  //Redraw the band and its scroll
+void chart_unscroll(void);                  //Redraw it at scroll offset 0
+#endif
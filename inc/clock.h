@@ -0,0 +1,34 @@
+/*****************************************************************************
+ * This header gives the MCU-side calendar clock. TIM14 advances a local     *
+ * copy of the time and date once a second, so reading the time costs no     *
+ * I2C transactions. The PCF8523 stays the reference: clock_sync() compares  *
+ * the two once a minute, steps the local clock back into line and trims     *
+ * the length of the TIM14 second to cancel the drift of the internal HSI    *
+ * oscillator. (The PCF8523's ~INT1 pin is not connected on the PCB, so its  *
+ * Timer A minute interrupt cannot be used to discipline the clock.)         *
+ * The clock also raises an event once per day boundary, however the local   *
+ * time got there (a TIM14 second or a step from clock_sync()).              *
+ *****************************************************************************/
+#ifndef __CLOCK_H
+#define __CLOCK_H
+#include "stm32f0xx.h"
+#include "rtc.h"
+
+typedef struct {
+    uint32_t syncs;         //Successful clock_sync() calls
+    uint32_t steps;         //Syncs that had to step the local clock
+    uint32_t failures;      //RTC reads that failed or had the OSC-STOP flag
+    int      last_err_s;    //Local minus RTC time at the last sync
+    int32_t  trim_ppm;      //Current lengthening of the TIM14 second
+} clock_stats_t;
+
+//Called with the date that has just ended; see clock_on_new_day()
+typedef void (*clock_day_fn)(const watch_datetime_t *ended);
+
+void init_clock(void);                  //Start TIM14 and load the time
+int  clock_load(void);                  //Copy the RTC time, restart tracking
+int  clock_sync(void);                  //Once a minute: compare, step, trim
+void clock_now(watch_datetime_t *dt);   //Current local time and date
+void clock_on_new_day(clock_day_fn fn);  //Register the day boundary event
+const clock_stats_t *clock_get_stats(void);
+#endif
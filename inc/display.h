@@ -0,0 +1,32 @@
+/*****************************************************************************
+ * This header gives the watch face. The display keeps a model of what is    *
+ * on the panel: each field (time, vitals, counters, profile) remembers the  *
+ * value it last drew. Setting a field to a new value marks it dirty, and    *
+ * display_update() redraws only the characters of the dirty fields that     *
+ * changed, without re-initialising or clearing the panel. HR and SpO2 are   *
+ * also charted over the last few minutes.                                   *
+ *****************************************************************************/
+#ifndef __DISPLAY_H
+#define __DISPLAY_H
+#include "stm32f0xx.h"
+
+enum {
+    DISP_TIME = 0,      //hour*60 + minute
+    DISP_SPO2,          //-1 if no wrist detected
+    DISP_HR,            //-1 if no wrist detected
+    DISP_TEMP,          //Tenths of a degree F
+    DISP_STEPS,
+    DISP_EE,            //Energy expenditure times 100
+    DISP_HEIGHT,        //Inches
+    DISP_WEIGHT,        //Pounds
+    DISP_AGE,
+    DISP_SEX,           //'M' or 'F'
+    DISP_FIELDS
+};
+
+void display_set(int field, int value);     //Marks the field dirty if changed
+void display_trend(int hr, int spo2);       //Once a second; spo2 -1 if none
+void display_update(void);                  //Redraw the dirty fields
+void display_draw_all(void);                //Clear and draw the whole face
+void display_pause(void);                   //Before drawing over the face
+#endif
@@ -0,0 +1,25 @@
+/*****************************************************************************
+ * This header gives the daily history kept by the watch. At each day        *
+ * boundary the day's counters are rolled into one record and the counters   *
+ * restart from zero. The last HISTORY_DAYS records are kept in RAM that is  *
+ * not cleared on reset, like the user's profile.                            *
+ *****************************************************************************/
+#ifndef __HISTORY_H
+#define __HISTORY_H
+#include "stm32f0xx.h"
+
+#define HISTORY_DAYS 7
+
+typedef struct {
+    uint8_t  day;
+    uint8_t  month;
+    uint8_t  year;          //Two digits
+    int32_t  steps;
+    int32_t  EE;            //Energy expenditure times 100
+    int32_t  EE_exercise;   //Of which while exercising, times 100
+} day_record_t;
+
+void history_add(const day_record_t *rec);      //Append, dropping the oldest
+int  history_get(int days_ago, day_record_t *rec); //1 = yesterday; -1 if none
+int  history_count(void);
+#endif
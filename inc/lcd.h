@@ -66,8 +66,49 @@ extern lcd_dev_t lcddev;
 #define LGRAYBLUE   0XA651
 #define LBBLUE      0X2B12
 
-void LCD_Setup(void);
+//===========================================================================
+// Fonts, generated into fonts.c by host/fontgen.c.
+// Each glyph keeps only the box around its set pixels, 1 bit per pixel,
+// row after row, with the first pixel in bit 0 of its first byte.
+//===========================================================================
+typedef struct {
+    u16 offset;         // First byte of the glyph in the font's bits[]
+    u8  x, y;           // Top-left of the box within the character cell
+    u8  w, h;           // Size of the box; 0 for a blank glyph
+    u8  advance;        // Width of the cell
+} lcd_glyph_t;
+
+typedef struct {
+    char left, right;
+    int8_t adjust;      // Added to the left glyph's advance
+} lcd_kern_t;
+
+typedef struct {
+    u8  size;           // The size that selects it: height, plus LCD_PROP
+    u8  height;         // Cell height
+    u8  first;          // First character in map[]
+    u8  count;          // Characters in map[]
+    u8  kerns;          // Pairs in kern[]
+    const u8 *map;      // Character - first to glyph; 0 (a space) if absent
+    const lcd_glyph_t *glyphs;
+    const u8 *bits;
+    const lcd_kern_t *kern;
+} lcd_font_t;
+
+// Add to a text size to use the proportional font of that height.
+#define LCD_PROP    0x80
+
+extern const lcd_font_t *const lcd_fonts[];    // Ends with 0
+
+void LCD_Setup(void);        // Once; later calls just LCD_Resume()
+void LCD_Resume(void);       // Restore MADCTL and the window
+void LCD_Sleep(int sleep);   // Sleep In (1) or Out (0); RAM is kept
+void LCD_DisplayOn(int on);
+void LCD_DMA_Init(void);
+void LCD_DMA_Wait(void);    // Wait for pixels still going out by DMA
+int  LCD_Busy(void);        // Non-zero while a DMA transfer is running
 void LCD_Init(void (*reset)(int), void (*select)(int), void (*reg_select)(int));
+void LCD_ForgetWindow(void);    // After setting the panel's window directly
 void LCD_Clear(u16 Color);
 void LCD_DrawPoint(u16 x,u16 y,u16 c);
 void LCD_DrawLine(u16 x1, u16 y1, u16 x2, u16 y2, u16 c);
@@ -76,8 +117,13 @@ void LCD_DrawFillRectangle(u16 x1, u16 y1, u16 x2, u16 y2, u16 c);
 void LCD_Circle(u16 xc, u16 yc, u16 r, u16 fill, u16 c);
 void LCD_DrawTriangle(u16 x0,u16 y0, u16 x1,u16 y1, u16 x2,u16 y2, u16 c);
 void LCD_DrawFillTriangle(u16 x0,u16 y0, u16 x1,u16 y1, u16 x2,u16 y2, u16 c);
+void LCD_SetClip(u16 x1, u16 y1, u16 x2, u16 y2);  // Limit filled shapes to a box
+void LCD_ClearClip(void);                           // Back to the whole display
 void LCD_DrawChar(u16 x,u16 y,u16 fc, u16 bc, char num, u8 size, u8 mode);
 void LCD_DrawString(u16 x,u16 y, u16 fc, u16 bg, const char *p, u8 size, u8 mode);
+int  LCD_MeasureString(const char *p, u8 size);     // Width in pixels
+int  LCD_DrawStringDiff(u16 x,u16 y, u16 fc, u16 bg, const char *p,
+                        char *shown, u8 size);      // Only what changed
 
 //===========================================================================
 // C Picture data structure.
@@ -91,4 +137,64 @@ typedef const struct {
 
 void LCD_DrawPicture(u16 x0, u16 y0, const Picture *pic);
 void LCD_Draw_Sprite(u16 *Image, int width, int height, u16 x0, u16 y0);
+
+//===========================================================================
+// Compressed images, made from PPM files by host/imgconv.c.
+// The palette formats are numbered by their bits per pixel.
+//===========================================================================
+enum {
+    LCD_IMG_PAL1   = 1,     // 2 colours
+    LCD_IMG_PAL2   = 2,     // 4 colours
+    LCD_IMG_PAL4   = 4,     // 16 colours
+    LCD_IMG_RGB565 = 16,    // Uncompressed
+    LCD_IMG_RLE565 = 17,    // Run-length coded RGB565
+};
+
+typedef struct {
+    u16 width;
+    u16 height;
+    u8  format;
+    const u16 *palette;     // Palette formats only
+    const u8  *data;
+} lcd_image_t;
+
+int  LCD_DrawImage(u16 x0, u16 y0, const lcd_image_t *img);
+
+//===========================================================================
+// Display lists for the band compositor.
+// Items are drawn in order; later items cover earlier ones.
+//===========================================================================
+enum { LCD_DL_RECT, LCD_DL_TEXT, LCD_DL_PICTURE };
+
+typedef struct {
+    u8  type;
+    u8  size;           // Font height (text)
+    u16 x, y;           // Top-left corner
+    u16 w, h;           // Size (rectangles)
+    u16 c;              // Colour (rectangles, text)
+    const void *data;   // The string (text) or the Picture
+} lcd_dl_t;
+
+#define DL_RECT(x,y,w,h,c)        { LCD_DL_RECT, 0, x, y, w, h, c, 0 }
+#define DL_TEXT(x,y,c,size,str)   { LCD_DL_TEXT, size, x, y, 0, 0, c, str }
+#define DL_PICTURE(x,y,pic)       { LCD_DL_PICTURE, 0, x, y, 0, 0, 0, pic }
+
+void LCD_Compose(u16 x0, u16 y0, u16 x1, u16 y1, u16 bg,
+                 const lcd_dl_t *dl, int n);
+
+//===========================================================================
+// Single columns and hardware scrolling, for strip charts.
+// The scrolling band is given in screen lines along the panel's long side:
+// columns in landscape. Its i-th line shows what was drawn at its line
+// (i + offset) % lines.
+//===========================================================================
+typedef struct {
+    u16 y0, y1;         // Rows covered, inclusive
+    u16 c;
+} lcd_run_t;
+
+void LCD_DrawColumn(u16 x, u16 y0, u16 y1, u16 bg, const lcd_run_t *runs, int n);
+#define LCD_EraseColumn(x,y0,y1,bg) LCD_DrawColumn(x,y0,y1,bg,0,0)
+void LCD_ScrollArea(u16 first, u16 last);   // Also resets the offset to 0
+void LCD_Scroll(u16 offset);
 #endif
@@ -0,0 +1,50 @@
+//============================================================================
+// lcd_spi.h: The interface between the drawing code in lcd.c and the SPI
+// side of the LCD driver in lcd_spi.c.
+//============================================================================
+
+#ifndef __LCD_SPI_H
+#define __LCD_SPI_H
+#include "lcd.h"
+
+// Sets up SPI1 and the LCD's pins (defined by the application).
+void init_lcd_spi(void);
+
+// Default pin hooks for lcddev (CS on PB8, nRESET on PB11, D/C on PB14).
+void tft_select(int val);
+void tft_reset(int val);
+void tft_reg_select(int val);
+
+// Command and parameter bytes, and polled 16-bit pixel data.
+void LCD_WR_REG(uint8_t data);
+void LCD_WR_DATA(uint8_t data);
+void LCD_WriteData16_Prepare(void);
+void LCD_WriteData16(u16 data);
+void LCD_WriteData16_End(void);
+
+// Queue a command with up to LCD_CMD_PARAMS 16-bit parameters (each sent
+// high byte first, as the ILI9341 expects), and send everything queued.
+// D/C only changes between a command and its parameters, and parameters go
+// out back to back. The bus is idle again when LCD_SendCmds() returns.
+#define LCD_CMD_QUEUE  4
+#define LCD_CMD_PARAMS 3
+void LCD_QueueCmd(uint8_t cmd, const u16 *params, int n);
+void LCD_SendCmds(void);
+
+// Send n pixels to the current window: n copies of c, or n pixels from src.
+// Long runs go out by DMA and may still be in progress on return.
+void LCD_FillPixels(u16 c, uint32_t n);
+void LCD_WritePixels(const u16 *src, uint32_t n);
+
+// Stream pixels that have to be computed first. Fill the buffer from
+// LCD_StreamBuffer() with up to LCD_STREAM_CHUNK pixels and pass it to
+// LCD_StreamSend(); the next buffer can be filled while it is sent.
+#define LCD_STREAM_CHUNK 64
+u16 *LCD_StreamBuffer(void);
+void LCD_StreamSend(u16 *buf, uint32_t n);
+
+// Claim the display for a drawing call, and give it back. If pixels are
+// still going out by DMA, the DMA interrupt releases it when they are done.
+void LCD_Select(void);
+void LCD_Release(void);
+#endif
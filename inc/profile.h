@@ -0,0 +1,43 @@
+/*****************************************************************************
+ * This header gives the cycle profiler for the sampling work. A probe wraps *
+ * one statement, PROFILE(stage, statement), and adds the CPU cycles it took *
+ * to that stage's minimum, average and maximum; profile_report() prints the *
+ * table over USART5. Without PROFILING defined the probes are just their    *
+ * statements and the profiler's functions do not exist.                     *
+ *****************************************************************************/
+#ifndef __PROFILE_H
+#define __PROFILE_H
+#include "stm32f0xx.h"
+
+//Uncomment to build the probes in
+//#define PROFILING
+
+enum {
+    PROF_PULSEOX = 0,   //pulseox_check()
+    PROF_SPO2,          //get_spo2()
+    PROF_HR,            //get_HR()
+    PROF_ACCEL,         //accel_sample()
+    PROF_STEP,          //detect_step()
+    PROF_TEMP,          //temp_fetch() and temp_trigger()
+    PROF_SYNC,          //clock_sync(): the RTC burst read
+    PROF_CLOCK,         //read_clock()
+    PROF_EE,            //EE_IEEE(), once a minute
+    PROF_VITALS,        //check_vitals()
+    PROF_SAMPLE,        //The whole sample task
+    PROF_STAGES
+};
+
+#ifdef PROFILING
+#define PROFILE(stage, ...) do {                                \
+        uint32_t prof_t0 = SysTick->VAL;                        \
+        __VA_ARGS__;                                            \
+        profile_add(stage, (prof_t0 - SysTick->VAL) & 0xffffff); \
+    } while(0)
+
+void profile_init(void);                    //Starts SysTick
+void profile_add(int stage, uint32_t cycles);
+void profile_report(void);
+#else
+#define PROFILE(stage, ...) do { __VA_ARGS__; } while(0)
+#endif
+#endif
@@ -5,10 +5,24 @@
  * counter algorithms. It will certainly be used for reseting EE and step    *
  * counts after midnight.                                                    *
  *****************************************************************************/
+#ifndef __RTC_H
+#define __RTC_H
 #include "stm32f0xx.h"
 
+typedef struct {
+    int seconds;
+    int minutes;
+    int hour;
+    int day;
+    int dayofweek;      //0 = Sun, 1 = Mon, ...
+    int month;
+    int year;           //Two digits
+    int osc_stopped;    //Oscillator-STOP flag: time is not valid
+} watch_datetime_t;
+
 void watch_write(uint8_t reg, uint8_t val); //Write data to the RTC
 uint8_t watch_read(uint8_t reg);            //Read from the RTC
+int watch_read_datetime(watch_datetime_t *dt); //Read the whole time & date at once
 int get_seconds(void);                      //The following get time & date
 int get_minutes(void);
 int get_hour(void);
@@ -24,3 +38,4 @@ void set_dayofweek(int dayofweek);
 void set_month(int month);
 void set_year(int year);
 void init_watch(void);                      //This command sets up the RTC
+#endif
@@ -0,0 +1,52 @@
+/*****************************************************************************
+ * This header gives the task scheduler that runs the watch's work from the  *
+ * main loop. A task is released either every period (by the scheduler's     *
+ * clock) or when an interrupt posts it; interrupts do nothing else.         *
+ * Released tasks run one at a time to completion, most important first, and *
+ * each run is checked against the task's deadline, counted from its         *
+ * release. With nothing to run it sleeps, in Stop mode when only an         *
+ * external interrupt can post the next task.                                *
+ *****************************************************************************/
+#ifndef __SCHED_H
+#define __SCHED_H
+#include "stm32f0xx.h"
+
+#define SCHED_MAX_TASKS 8
+#define SCHED_MS(ms)    ((ms) * 1000)       //Times are in microseconds
+
+typedef struct {
+    const char *name;
+    void     (*run)(void);
+    uint32_t period_us;     //0 if only released by sched_post()
+    uint32_t deadline_us;   //From release to the end of the run
+    uint8_t  priority;      //0 is the most important
+    uint8_t  timed;         //Posted by a timer that Stop mode halts
+} sched_task_t;
+
+typedef struct {
+    uint32_t runs;
+    uint32_t late;          //Runs that ended past the deadline
+    uint32_t missed;        //Releases that found the task still pending
+    uint32_t worst_us;      //Longest release-to-end time
+    uint32_t worst_run_us;  //Longest run
+} sched_stats_t;
+
+typedef struct {
+    uint32_t run_ms;        //Running tasks
+    uint32_t sleep_ms;      //Sleep mode (WFI), the CPU clock stopped
+    uint32_t stop_ms;       //Stop mode, all clocks stopped
+    uint32_t sleeps;
+    uint32_t stops;
+} sched_power_t;
+
+void     sched_init(const sched_task_t *tasks, int n);  //Starts all tasks
+void     sched_run(void);           //Run one released task, or sleep
+void     sched_post(int task);      //Release now; safe from interrupts
+void     sched_start(int task);
+void     sched_stop(int task);      //Drops its releases until started
+uint32_t sched_now(void);           //Free-running microsecond clock
+void     sched_on_stop(int (*quiet)(void), void (*wake)(void));
+const sched_stats_t *sched_get_stats(int task);
+const sched_power_t *sched_get_power(void);
+void     sched_report(void);        //Prints the stats over USART5
+#endif
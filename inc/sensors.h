@@ -10,6 +10,8 @@ void temp_write(uint8_t reg0, uint8_t val0, uint8_t val1);
 uint8_t temp_simple_read(uint8_t reg);
 void temp_read_array(uint8_t loc, char data[], uint8_t len);
 void init_temp_sensor(void);
+void temp_trigger(void);                            //Start a temperature conversion
+int temp_fetch(void);                               //Read it (10*F, -1 if not ready)
 int get_temp(void);
 void pulseox_write(uint8_t reg, uint8_t val);
 uint8_t pulseox_simple_read(uint8_t reg);
@@ -17,7 +19,7 @@ void pulseox_read_array(uint8_t loc, char data[], uint8_t len);
 void pulseox_setup(void);
 void pulseox_check(void);
 int get_spo2(void);
-int get_HR(void);
+int get_HR(uint32_t t_us);                          //t_us: time of this sample
 void accelerometer_write(uint8_t reg, uint8_t val); //Write to the Accelerometer
 void init_accelerometer(void);                      //Configure the Accelerometer
 uint8_t accelerometer_read(uint8_t reg);            //Read from the Accelerometer
@@ -1,9 +1,30 @@
 /*****************************************************************************
- * This header file gives a list of the two functions used for the sending   *
- * data to the terminal. The only one that is important is init_usart5().    *
+ * This header file gives the functions used for sending data to the         *
+ * terminal. The only one that is important is init_usart5(); printf() then  *
+ * goes through a transmit buffer that USART5's interrupt empties, so a      *
+ * print only costs the time to copy it. When the buffer is full the rest    *
+ * is dropped (and counted) or the caller waits, as set by uart_tx_policy(). *
  *****************************************************************************/
+#ifndef __UART_H
+#define __UART_H
 #include "stm32f0xx.h"
 #include <stdio.h>
 
+#define UART_TX_BUF   512       //Power of two
+#define UART_TX_DROP  0         //Drop what does not fit (the default)
+#define UART_TX_BLOCK 1         //Wait for room; interrupts send by polling
+
+typedef struct {
+    uint32_t bytes;             //Bytes queued
+    uint32_t dropped;           //Bytes dropped with the buffer full
+    uint32_t waits;             //Writes that waited for room
+    uint32_t peak;              //Most bytes ever waiting in the buffer
+} uart_stats_t;
+
 void init_usart5(void);  //Initializes the USART to send data to terminal
 int __io_putchar(int c); //Helper function for printf; not called by user
+int  uart_write(const char *s, int len);    //Queue; returns bytes taken
+void uart_tx_policy(int policy);
+int  uart_tx_idle(void);                    //Everything has been sent
+const uart_stats_t *uart_get_stats(void);
+#endif
@@ -19,6 +19,7 @@
 #include "i2c.h"
 #include "uart.h"
 #include "rtc.h"
+#include "sensors.h"
 #include "accelerometer_algorithms.h"
 #include <math.h>
 
@@ -39,7 +40,7 @@ short exercising = 0;
 //=============================================================================
 void accel_sample(void) {
 	//Update table
-	for(int i = sizeof(a_mag)/sizeof(a_mag[0]);i>0;i--)
+	for(int i = sizeof(a_mag)/sizeof(a_mag[0]) - 1;i>0;i--)
 		a_mag[i] = a_mag[i-1];
 
 	//Signal processing (converting to gs)
@@ -136,15 +137,14 @@ int EE_IEEE(int weight) {
 }
 
 //=============================================================================
-// MIDNIGHT
-//	* Called periodically. Returns a 1 if time is midnight.
-//	* Used to reset counts if necessary.
+// EE_NEW_DAY
+//	* Called once at each day boundary (see new_day() in main.c).
+//	* Returns the EE spent exercising during the day that ended (times 100),
+//	  then resets both EE counters.
 //=============================================================================
-int midnight() {
-	if(get_minutes() == 0 && get_hour() == 0) {
-		EE = 0;
-		EE_exercise = 0;
-		return 1;
-	}
-	return 0;
+int EE_new_day(void) {
+	int EE_exercise_int = EE_exercise * 100;
+	EE = 0;
+	EE_exercise = 0;
+	return EE_exercise_int;
 }
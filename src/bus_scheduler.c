@@ -0,0 +1,124 @@
+/*****************************************************************************
+ * This code schedules the I2C transactions of the Sensors-to-MCU and Watch  *
+ * and Accelerometer Data subsystems across the 30Hz sampling ticks. The     *
+ * schedule repeats every hyperperiod (the LCM of all slot periods), so the  *
+ * worst-case bus time of any tick can be found once at startup.             *
+ *****************************************************************************/
+#include "stm32f0xx.h"
+#include <stdio.h>
+#include "bus_scheduler.h"
+
+static bus_slot_t *slots;
+static int         nslots;
+static uint32_t    hyper = 1;   //Ticks before the schedule repeats
+static uint32_t    tick;
+static uint32_t    worst_us;
+
+static uint32_t gcd(uint32_t a, uint32_t b) {
+    while(b) {
+        uint32_t t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+//============================================================================
+// TICK_LOAD
+//  * Bus time needed on tick t by the first n slots.
+//============================================================================
+static uint32_t tick_load(uint32_t t, int n) {
+    uint32_t load = 0;
+    for(int k = 0; k < n; k++)
+        if(t % slots[k].period == slots[k].phase)
+            load += slots[k].cost_us;
+    return load;
+}
+
+//============================================================================
+// SLOT_WORST
+//  * Worst bus time over the ticks on which slot k fires, counting only the
+//    slots that have already been placed (those before k).
+//============================================================================
+static uint32_t slot_worst(int k) {
+    uint32_t worst = 0;
+    for(uint32_t t = slots[k].phase; t < hyper; t += slots[k].period) {
+        uint32_t load = tick_load(t, k + 1);
+        if(load > worst)
+            worst = load;
+    }
+    return worst;
+}
+
+//============================================================================
+// BUS_SCHED_INIT
+//  * Sorts the slots by priority, then places them one at a time. Each slot
+//    keeps its requested phase if that fits in the budget; otherwise the
+//    next phase that fits is used (or the least loaded one if none does).
+//    Higher priority slots are placed first so they are never moved for a
+//    less important one.
+//  * Prints the resulting schedule and the worst-case tick over USART5.
+//============================================================================
+void bus_sched_init(bus_slot_t *table, int n, uint32_t budget_us) {
+    slots  = table;
+    nslots = n;
+    tick   = 0;
+    hyper  = 1;
+    worst_us = 0;
+
+    for(int k = 1; k < n; k++) {        //Insertion sort (stable) by priority
+        bus_slot_t s = slots[k];
+        int j = k;
+        for(; j > 0 && slots[j-1].priority > s.priority; j--)
+            slots[j] = slots[j-1];
+        slots[j] = s;
+    }
+    for(int k = 0; k < n; k++) {
+        if(slots[k].period == 0)
+            slots[k].period = 1;
+        slots[k].phase %= slots[k].period;
+        hyper = hyper / gcd(hyper, slots[k].period) * slots[k].period;
+    }
+
+    for(int k = 0; k < n; k++) {
+        uint16_t wanted = slots[k].phase;
+        uint16_t best   = wanted;
+        uint32_t best_us = 0xffffffff;
+        for(int j = 0; j < slots[k].period; j++) {
+            slots[k].phase = (wanted + j) % slots[k].period;
+            uint32_t load = slot_worst(k);
+            if(load < best_us) {
+                best_us = load;
+                best    = slots[k].phase;
+            }
+            if(load <= budget_us)
+                break;
+        }
+        slots[k].phase = best;
+        if(best_us > worst_us)
+            worst_us = best_us;
+    }
+
+    printf("Bus schedule (%lu us budget per tick):\n", (unsigned long)budget_us);
+    for(int k = 0; k < n; k++)
+        printf("  %-8s every %4u ticks, phase %4u, %5u us\n", slots[k].name,
+               slots[k].period, slots[k].phase, slots[k].cost_us);
+    printf("Worst-case tick: %lu us\n", (unsigned long)worst_us);
+}
+
+//============================================================================
+// BUS_SCHED_TICK
+//  * Called once per sampling tick. Runs every slot due on this tick, most
+//    important first.
+//============================================================================
+void bus_sched_tick(void) {
+    for(int k = 0; k < nslots; k++)
+        if(tick % slots[k].period == slots[k].phase)
+            slots[k].sample();
+    if(++tick >= hyper)
+        tick = 0;
+}
+
+uint32_t bus_sched_worst_us(void) {
+    return worst_us;
+}
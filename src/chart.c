@@ -0,0 +1,100 @@
+/*****************************************************************************
+ * This code draws the strip chart. Samples are kept in a ring indexed by    *
+ * the RAM column they are drawn in. A new sample overwrites the oldest      *
+ * column, and the band is scrolled by one so that column appears on the     *
+ * right: per sample, one column of pixels and one scroll command. Each      *
+ * column draws its trace as a vertical run from the previous sample to its  *
+ * own, so the traces stay joined.                                           *
+ *****************************************************************************/
+#include "stm32f0xx.h"
+#include "lcd.h"
+#include "chart.h"
+
+static const chart_cfg_t *cfg;
+static int16_t samples[CHART_TRACES][CHART_COLUMNS];
+static int16_t before[CHART_TRACES];    //Scrolled out of the oldest column
+static int     columns;
+static int     head;                    //Oldest column, overwritten next
+
+void chart_init(const chart_cfg_t *c) {
+    cfg = c;
+    columns = cfg->x1 - cfg->x0 + 1;
+    if(columns > CHART_COLUMNS)
+        columns = CHART_COLUMNS;
+    for(int t = 0; t < CHART_TRACES; t++) {
+        for(int k = 0; k < CHART_COLUMNS; k++)
+            samples[t][k] = CHART_NONE;
+        before[t] = CHART_NONE;
+    }
+    head = 0;
+}
+
+static int row(const chart_trace_t *tr, int v) {
+    int y = tr->y1 - (v - tr->lo) * (tr->y1 - tr->y0) / (tr->hi - tr->lo);
+    if(y < tr->y0)
+        return tr->y0;
+    if(y > tr->y1)
+        return tr->y1;
+    return y;
+}
+
+//============================================================================
+// DRAW_COLUMN
+//  * Draws RAM column k: the grid, then each trace from the sample before
+//    it to its own.
+//============================================================================
+static void draw_column(int k) {
+    lcd_run_t runs[CHART_GRID + CHART_TRACES];
+    int n = 0;
+    for(int g = 0; g < cfg->ngrid && g < CHART_GRID; g++)
+        runs[n++] = cfg->grid[g];
+    for(int t = 0; t < cfg->ntraces; t++) {
+        const chart_trace_t *tr = &cfg->trace[t];
+        int v = samples[t][k];
+        int p = k == head ? before[t] : samples[t][(k + columns - 1) % columns];
+        if(v == CHART_NONE)
+            continue;
+        int a = row(tr, v);
+        int b = p == CHART_NONE ? a : row(tr, p);
+        runs[n].y0 = a < b ? a : b;
+        runs[n].y1 = a < b ? b : a;
+        runs[n].c  = tr->c;
+        n++;
+    }
+    LCD_DrawColumn(cfg->x0 + k, cfg->y0, cfg->y1, cfg->bg, runs, n);
+}
+
+void chart_add(const int16_t *values) {
+    int k = head;
+    for(int t = 0; t < cfg->ntraces; t++) {
+        before[t] = samples[t][k];
+        samples[t][k] = values[t];
+    }
+    head = (head + 1) % columns;
+    draw_column(k);
+    LCD_Scroll(head);   //Oldest on the left, column k on the right
+}
+
+//============================================================================
+// CHART_UNSCROLL
+//  * Moves the columns so the band shows the chart at scroll offset 0. The
+//    band can then be drawn over like any other part of the screen.
+//============================================================================
+void chart_unscroll(void) {
+    int16_t s[CHART_COLUMNS];
+    for(int t = 0; t < CHART_TRACES; t++) {
+        for(int k = 0; k < columns; k++)
+            s[k] = samples[t][(head + k) % columns];
+        for(int k = 0; k < columns; k++)
+            samples[t][k] = s[k];
+    }
+    head = 0;
+    chart_draw_all();
+}
+
+void chart_draw_all(void) {
+    LCD_ScrollArea(cfg->x0, cfg->x0 + columns - 1);
+    for(int k = 0; k < columns; k++)
+        draw_column(k);
+    LCD_Scroll(head);
+}
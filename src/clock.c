@@ -0,0 +1,253 @@
+/*****************************************************************************
+ * This code keeps the watch's time and date on the MCU. TIM14 interrupts    *
+ * once a second and advances a local calendar, so the display and the       *
+ * algorithms can ask for the time without touching the I2C bus.             *
+ *                                                                           *
+ * The local second comes from the internal HSI oscillator, which can be     *
+ * off by up to 1% (0.6s a minute). Once a minute the bus scheduler calls    *
+ * clock_sync(), which reads the PCF8523 in one burst, steps the local clock *
+ * to match and adds the error to a running total. When that total reaches   *
+ * CLOCK_TRIM_ERR_S the drift over the whole interval is turned into a ppm   *
+ * trim, which lengthens or shortens the following TIM14 seconds by whole    *
+ * 100us timer ticks. The trim is refined every time, so it keeps following  *
+ * the HSI as it drifts with temperature.                                    *
+ *                                                                           *
+ * Whenever the local date moves past the last one seen, the new-day event   *
+ * is raised once with the date that ended, from whatever moved the clock:   *
+ * TIM14's interrupt, or a task through clock_sync() or clock_load(). Those  *
+ * two run from the main loop and keep TIM14 masked while they change the    *
+ * clock, so a second cannot be added to a half-copied time.                 *
+ *****************************************************************************/
+#include "stm32f0xx.h"
+#include "rtc.h"
+#include "clock.h"
+
+#define CLOCK_TICKS_PER_S  10000   //TIM14 at 48MHz/4800
+#define CLOCK_PPM_PER_TICK (1000000 / CLOCK_TICKS_PER_S)
+#define CLOCK_MAX_STEP_S   5       //Larger errors mean the RTC was set
+#define CLOCK_TRIM_ERR_S   4       //Error to collect before re-trimming
+#define CLOCK_MAX_TRIM_PPM 30000   //HSI is within 1% at 25C, plus margin
+
+static volatile watch_datetime_t now;      //Local calendar
+static volatile uint32_t seq;              //Odd while now is being written
+static volatile uint32_t uptime_s;         //Local seconds since init_clock()
+static int      loaded;                    //now holds a valid RTC time
+static int32_t  trim_acc;                  //Fraction of a tick not yet applied
+static uint32_t drift_start_s;             //uptime_s when the total restarted
+static int      drift_err_s;               //Error collected since then
+static clock_stats_t stats;
+static watch_datetime_t today;             //Latest date seen
+static clock_day_fn     day_fn;
+
+static const uint8_t month_days[12] = {31,28,31,30,31,30,31,31,30,31,30,31};
+
+static int seconds_of_day(const volatile watch_datetime_t *dt) {
+    return dt->hour*3600 + dt->minutes*60 + dt->seconds;
+}
+
+static int32_t date_key(const volatile watch_datetime_t *dt) {
+    return (dt->year*12 + dt->month - 1)*31 + dt->day - 1;
+}
+
+//============================================================================
+// NEW_DAY_CHECK
+//  * Raises the new-day event if the local date is later than any seen so
+//    far. Setting the clock back does not lower that mark, so a day boundary
+//    that has been reported is never reported again.
+//============================================================================
+static void new_day_check(void) {
+    if(date_key(&now) <= date_key(&today))
+        return;
+    watch_datetime_t ended = today;
+    today = now;
+    if(day_fn)
+        day_fn(&ended);
+}
+
+//============================================================================
+// CLOCK_TICK
+//  * Advances the local calendar by one second (the RTC keeps a two-digit
+//    year, so every fourth year is a leap year).
+//  * Sets the length of the next second from the trim. The fraction of a
+//    timer tick left over is carried so the average length is exact.
+//============================================================================
+static void clock_tick(void) {
+    TIM14->SR &= ~TIM_SR_UIF; //Acknowledge Interrupt
+
+    seq++;
+    if(++now.seconds == 60) {
+        now.seconds = 0;
+        if(++now.minutes == 60) {
+            now.minutes = 0;
+            if(++now.hour == 24) {
+                now.hour = 0;
+                now.dayofweek = (now.dayofweek + 1) % 7;
+                int days = month_days[(now.month - 1) % 12];
+                if(now.month == 2 && now.year % 4 == 0)
+                    days = 29;
+                if(++now.day > days) {
+                    now.day = 1;
+                    if(++now.month > 12) {
+                        now.month = 1;
+                        now.year  = (now.year + 1) % 100;
+                    }
+                }
+            }
+        }
+    }
+    uptime_s++;
+    seq++;
+    if(now.hour == 0 && now.minutes == 0 && now.seconds == 0)
+        new_day_check();
+
+    trim_acc += stats.trim_ppm;
+    int32_t ticks = trim_acc / CLOCK_PPM_PER_TICK;
+    trim_acc -= ticks * CLOCK_PPM_PER_TICK;
+    TIM14->ARR = CLOCK_TICKS_PER_S - 1 + ticks;
+}
+
+void TIM14_IRQHandler(void) {
+    if(TIM14->SR & TIM_SR_UIF)  //clock_sync() may have handled it already
+        clock_tick();
+}
+
+static void clock_set(const watch_datetime_t *dt) {
+    seq++;
+    now = *dt;
+    seq++;
+}
+
+static void tim14_mask(void) {
+    NVIC->ICER[0] = 1 << TIM14_IRQn;
+}
+
+static void tim14_unmask(void) {
+    NVIC->ISER[0] = 1 << TIM14_IRQn;
+}
+
+//============================================================================
+// CLOCK_LOAD
+//  * Copies the RTC's time into the local clock. Used at startup and after
+//    the time has been set, so the drift total is restarted (the trim is
+//    kept; the HSI has not changed).
+//  * Returns 0 on success, -1 if the RTC could not be read or its oscillator
+//    has stopped. clock_sync() will then load it once it can.
+//============================================================================
+static int load(void) {
+    watch_datetime_t rtc;
+    if(watch_read_datetime(&rtc) || rtc.osc_stopped) {
+        stats.failures++;
+        return -1;
+    }
+    clock_set(&rtc);
+    if(!loaded)
+        today = rtc;    //Starting up is not a day boundary
+    new_day_check();
+    loaded        = 1;
+    drift_start_s = uptime_s;
+    drift_err_s   = 0;
+    return 0;
+}
+
+int clock_load(void) {
+    tim14_mask();
+    int r = load();
+    tim14_unmask();
+    return r;
+}
+
+//============================================================================
+// CLOCK_SYNC
+//  * Compares the local clock with the RTC and steps it back if they differ.
+//    A second that ended while the caller kept TIM14 from interrupting is
+//    counted first, so it is not mistaken for drift.
+//  * Once CLOCK_TRIM_ERR_S seconds of error have been collected, the drift
+//    since the total restarted is added to the trim. Waiting for several
+//    seconds keeps the +-1s uncertainty of each whole-second comparison
+//    small against what is being measured.
+//  * Returns 0 on success, -1 if the RTC could not be read.
+//============================================================================
+static int sync(void) {
+    if(TIM14->SR & TIM_SR_UIF)
+        clock_tick();
+    if(!loaded)
+        return load();
+
+    watch_datetime_t rtc;
+    if(watch_read_datetime(&rtc) || rtc.osc_stopped) {
+        stats.failures++;
+        return -1;
+    }
+    int err = seconds_of_day(&now) - seconds_of_day(&rtc);
+    if(err > 12*3600)                   //Across midnight
+        err -= 24*3600;
+    else if(err < -12*3600)
+        err += 24*3600;
+    stats.syncs++;
+    stats.last_err_s = err;
+
+    if(err > CLOCK_MAX_STEP_S || err < -CLOCK_MAX_STEP_S)
+        return load();
+    if(err) {
+        clock_set(&rtc);
+        new_day_check();
+        stats.steps++;
+    }
+
+    drift_err_s += err;
+    if(drift_err_s >= CLOCK_TRIM_ERR_S || drift_err_s <= -CLOCK_TRIM_ERR_S) {
+        int32_t elapsed = uptime_s - drift_start_s;
+        int32_t trim    = stats.trim_ppm + drift_err_s*1000000 / elapsed;
+        if(trim > CLOCK_MAX_TRIM_PPM)
+            trim = CLOCK_MAX_TRIM_PPM;
+        if(trim < -CLOCK_MAX_TRIM_PPM)
+            trim = -CLOCK_MAX_TRIM_PPM;
+        stats.trim_ppm = trim;
+        drift_start_s  = uptime_s;
+        drift_err_s    = 0;
+    }
+    return 0;
+}
+
+int clock_sync(void) {
+    tim14_mask();
+    int r = sync();
+    tim14_unmask();
+    return r;
+}
+
+//============================================================================
+// CLOCK_NOW
+//  * Copies the local time and date. Costs no bus transactions.
+//  * Retries if TIM14 or a sync changed the time part-way through the copy.
+//    Must not be called from an interrupt that can preempt TIM14.
+//============================================================================
+void clock_now(watch_datetime_t *dt) {
+    uint32_t s;
+    do {
+        s   = seq;
+        *dt = now;
+    } while((s & 1) || s != seq);
+}
+
+void clock_on_new_day(clock_day_fn fn) {
+    day_fn = fn;
+}
+
+const clock_stats_t *clock_get_stats(void) {
+    return &stats;
+}
+
+//============================================================================
+// INIT_CLOCK
+//  * Sets TIM14 to interrupt once a second and loads the time from the RTC.
+//============================================================================
+void init_clock(void) {
+    RCC->APB1ENR |= RCC_APB1ENR_TIM14EN;
+    TIM14->PSC = 4800 - 1;
+    TIM14->ARR = CLOCK_TICKS_PER_S - 1;
+    TIM14->DIER |= TIM_DIER_UIE;
+    load();
+    TIM14->CR1 |= TIM_CR1_CEN;
+    NVIC->ISER[0] = 1 << TIM14_IRQn;
+}
@@ -0,0 +1,237 @@
+/*****************************************************************************
+ * This code draws the watch face. The layout is a table of fields, each     *
+ * with its label, the position and font of its value and how many           *
+ * characters wide the value can get. A field's value is padded with spaces  *
+ * to that width and laid out in fixed-width cells, so nothing shifts as it  *
+ * changes. The face remembers the text each field shows, and a redraw       *
+ * sends only the cells whose character changed, opaque on the face's        *
+ * background: a new minute usually rewrites one digit of the clock.         *
+ *                                                                           *
+ * The right of the face is a strip chart of HR and SpO2, one column per     *
+ * TREND_S seconds of averages. It is the panel's scrolling band, so it      *
+ * spans the full height and no field may be placed in it.                   *
+ *                                                                           *
+ * Only display_draw_all() draws the whole face; it is used at startup and   *
+ * when leaving the settings menu, which draws over the bottom of the face.  *
+ * It composes the face from a display list in bands, so each pixel is sent  *
+ * once and the panel is never seen blank or half drawn.                     *
+ *                                                                           *
+ * display_set() and display_trend() only record values and mark fields      *
+ * dirty, so interrupts may call them. The drawing functions run from the    *
+ * main loop; they take the dirty fields with interrupts briefly off and     *
+ * draw with them on, so a value changed during a draw is drawn next time.   *
+ *****************************************************************************/
+#include "stm32f0xx.h"
+#include <stdio.h>
+#include <string.h>
+#include "lcd.h"
+#include "display.h"
+#include "chart.h"
+
+#define FACE_BG     0x18e4
+#define FACE_BORDER 0xa65b
+#define TIME_FC     0xf924
+#define HR_FC       0xf8a0
+#define SPO2_FC     0x07ff
+
+#define TREND_S     10      //Seconds averaged into each chart column
+#define CHART_X0    257     //Chart band; the divider is at CHART_X0-1
+#define CHART_X1    313
+
+typedef struct {
+    const char *label;
+    u16 lx, ly;         //Label position
+    u16 x, y;           //Value position
+    u8  size;           //Font height
+    u8  chars;          //Widest value, in characters
+    u16 fc;
+} field_t;
+
+static const field_t fields[DISP_FIELDS] = {
+    [DISP_TIME]   = { 0,         0,   0,  71,  96, 48, 5, TIME_FC },
+    [DISP_SPO2]   = { "SpO2",  106,  10, 106,  26, 16, 4, WHITE },
+    [DISP_HR]     = { "HR",    150,  10, 150,  26, 16, 3, WHITE },
+    [DISP_TEMP]   = { "TEMP",  186,  10, 186,  26, 16, 7, WHITE },
+    [DISP_STEPS]  = { "STEPS",  10,  10,  10,  26, 16, 5, WHITE },
+    [DISP_EE]     = { "EE",     62,  10,  62,  26, 16, 4, WHITE },
+    [DISP_HEIGHT] = { "HEIGHT", 80, 213,  80, 197, 16, 5, WHITE },
+    [DISP_WEIGHT] = { "WEIGHT", 10, 213,  10, 197, 16, 6, WHITE },
+    [DISP_AGE]    = { "Age",   150, 213, 150, 197, 16, 3, WHITE },
+    [DISP_SEX]    = { "Sex",   200, 213, 200, 197, 16, 1, WHITE },
+};
+
+static int value[DISP_FIELDS];
+static int shown[DISP_FIELDS];
+static char shown_text[DISP_FIELDS][16];    //As it is on the panel
+static volatile uint32_t dirty;
+
+//HR above SpO2, split by a rule; the band's border rows are never redrawn.
+static const lcd_run_t chart_grid[] = {
+    { 122, 122, FACE_BORDER },
+};
+
+static const chart_cfg_t chart_cfg = {
+    CHART_X0, CHART_X1, 7, 233, FACE_BG, chart_grid, 1, 2, {
+        {  12, 117, 40, 160, HR_FC   },     //bpm
+        { 127, 228, 80, 100, SPO2_FC },     //%
+    }
+};
+
+static int     chart_ready;
+static int     trend_secs, trend_n;
+static int32_t trend_hr, trend_spo2;
+static volatile int trend_due;
+static int16_t trend[2];
+
+void display_set(int field, int v) {
+    value[field] = v;
+    if(v != shown[field]) {
+        __disable_irq();
+        dirty |= 1 << field;
+        __enable_irq();
+    }
+}
+
+static uint32_t take_dirty(void) {
+    __disable_irq();
+    uint32_t d = dirty;
+    dirty = 0;
+    __enable_irq();
+    return d;
+}
+
+//============================================================================
+// FORMAT
+//  * Text of a field's value, as the face has always shown it.
+//============================================================================
+static void format(int field, int v, char *s) {
+    switch(field) {
+    case DISP_TIME:   sprintf(s, "%02d:%02d", v/60, v%60);  break;
+    case DISP_SPO2:   if(v == -1) strcpy(s, "N/A"); else sprintf(s, "%-3d%%", v); break;
+    case DISP_HR:     if(v == -1) strcpy(s, "N/A"); else sprintf(s, "%-3d", v);   break;
+    case DISP_TEMP:   sprintf(s, "%d.%d^F", v/10, v%10);    break;
+    case DISP_STEPS:  sprintf(s, "%-5d", v);                break;
+    case DISP_EE:     sprintf(s, "%-4d", v/100);            break; //Truncate to Int
+    case DISP_HEIGHT: sprintf(s, "%d'%2d\"", v/12, v%12);   break;
+    case DISP_WEIGHT: sprintf(s, "%-3dlbs", v);             break;
+    case DISP_AGE:    sprintf(s, "%-3d", v);                break;
+    case DISP_SEX:    sprintf(s, "%c", v);                  break;
+    }
+}
+
+//============================================================================
+// FIELD_TEXT
+//  * The value's text padded (or cut) to the field's width.
+//============================================================================
+static void field_text(int field, char *s) {
+    int v = value[field];
+    format(field, v, s);
+    int n = strlen(s);
+    while(n < fields[field].chars)
+        s[n++] = ' ';
+    s[fields[field].chars] = 0;
+    shown[field] = v;
+}
+
+//============================================================================
+// DRAW_FIELD
+//  * Redraws the characters of one value that differ from what is shown.
+//============================================================================
+static void draw_field(int field) {
+    const field_t *f = &fields[field];
+    char s[16];
+    field_text(field, s);
+    LCD_DrawStringDiff(f->x, f->y, f->fc, FACE_BG, s, shown_text[field], f->size);
+}
+
+//============================================================================
+// DISPLAY_TREND
+//  * Averages HR and SpO2 over TREND_S calls, one per second, leaving out
+//    the seconds with no reading. The average is the chart's next column,
+//    drawn by display_update(); a period with no readings is a gap.
+//============================================================================
+void display_trend(int hr, int spo2) {
+    if(spo2 != -1) {
+        trend_hr   += hr;
+        trend_spo2 += spo2;
+        trend_n++;
+    }
+    if(++trend_secs < TREND_S)
+        return;
+    trend[0] = trend_n ? trend_hr / trend_n : CHART_NONE;
+    trend[1] = trend_n ? trend_spo2 / trend_n : CHART_NONE;
+    trend_due = 1;
+    trend_secs = trend_n = 0;
+    trend_hr = trend_spo2 = 0;
+}
+
+void display_update(void) {
+    uint32_t d = take_dirty();
+    for(int k = 0; k < DISP_FIELDS; k++)
+        if(d & (1 << k))
+            draw_field(k);
+    if(!trend_due)
+        return;
+    int16_t t[2];
+    __disable_irq();
+    t[0] = trend[0];
+    t[1] = trend[1];
+    trend_due = 0;
+    __enable_irq();
+    if(chart_ready)
+        chart_add(t);
+}
+
+//============================================================================
+// DISPLAY_PAUSE
+//  * For drawing over the face (the settings menu): leaves the chart's band
+//    unscrolled, so what is drawn there shows where it is drawn. Nothing
+//    may be drawn on the face until display_draw_all().
+//============================================================================
+void display_pause(void) {
+    if(chart_ready)
+        chart_unscroll();
+}
+
+static const lcd_dl_t border[] = {
+    DL_RECT(  0,   0, 320,   7, FACE_BORDER),
+    DL_RECT(  0,   0,   7, 240, FACE_BORDER),
+    DL_RECT(  0, 234, 320,   6, FACE_BORDER),
+    DL_RECT(314,   0,   6, 240, FACE_BORDER),
+    DL_RECT(CHART_X0-1, 0, 1, 240, FACE_BORDER),
+};
+
+#define BORDER_ITEMS ((int)(sizeof(border)/sizeof(border[0])))
+
+//============================================================================
+// DISPLAY_DRAW_ALL
+//  * Composes the face left of the chart and the strip right of it. The
+//    chart's band is not composed: its border rows are plain fills, which
+//    look the same at any scroll offset, and the chart redraws the rest.
+//============================================================================
+void display_draw_all(void) {
+    char    text[DISP_FIELDS][16];
+    lcd_dl_t dl[BORDER_ITEMS + 2*DISP_FIELDS];
+    int n = 0;
+    take_dirty();
+    if(!chart_ready) {
+        chart_init(&chart_cfg);
+        chart_ready = 1;
+    }
+    for(int k = 0; k < BORDER_ITEMS; k++)
+        dl[n++] = border[k];
+    for(int k = 0; k < DISP_FIELDS; k++) {
+        const field_t *f = &fields[k];
+        if(f->label)
+            dl[n++] = (lcd_dl_t)DL_TEXT(f->lx, f->ly, WHITE, 16|LCD_PROP, f->label);
+        field_text(k, text[k]);
+        dl[n++] = (lcd_dl_t)DL_TEXT(f->x, f->y, f->fc, f->size, text[k]);
+    }
+    LCD_Compose(0, 0, CHART_X0-1, 239, FACE_BG, dl, n);
+    LCD_Compose(CHART_X1+1, 0, 319, 239, FACE_BG, dl, BORDER_ITEMS);
+    LCD_DrawFillRectangle(CHART_X0, 0, CHART_X1, chart_cfg.y0-1, FACE_BORDER);
+    LCD_DrawFillRectangle(CHART_X0, chart_cfg.y1+1, CHART_X1, 239, FACE_BORDER);
+    chart_draw_all();
+    for(int k = 0; k < DISP_FIELDS; k++)
+        strcpy(shown_text[k], text[k]);
+}
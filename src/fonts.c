@@ -0,0 +1,809 @@
+/*****************************************************************************
+ * Generated by host/fontgen.c from fonts/fonts.def; do not edit. Change     *
+ * the font sources or fonts.def and run fontgen again.                      *
+ *****************************************************************************/
+#include "stm32f0xx.h"
+#include "lcd.h"
+
+//12 pixels high, fixed width, 95 glyphs
+static const u8 font12_map[95] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b,
+    0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+    0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20, 0x21, 0x22, 0x23,
+    0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b,
+    0x3c, 0x3d, 0x3e, 0x3f, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50, 0x51, 0x52, 0x53,
+    0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e
+};
+
+static const lcd_glyph_t font12_glyphs[95] = {
+    //offset  x   y   w   h  advance
+    {     0,  0,  0,  0,  0,  6 }, /*" "*/
+    {     0,  2,  2,  1,  8,  6 }, /*"!"*/
+    {     1,  1,  1,  4,  3,  6 }, /*"""*/
+    {     3,  0,  2,  6,  8,  6 }, /*"#"*/
+    {     9,  0,  1,  5, 10,  6 }, /*"$"*/
+    {    16,  0,  2,  6,  8,  6 }, /*"%"*/
+    {    22,  0,  2,  6,  8,  6 }, /*"&"*/
+    {    28,  0,  1,  2,  3,  6 }, /*"'"*/
+    {    29,  3,  1,  3, 10,  6 }, /*"("*/
+    {    33,  1,  1,  3, 10,  6 }, /*")"*/
+    {    37,  0,  3,  5,  6,  6 }, /*"*"*/
+    {    41,  0,  2,  5,  7,  6 }, /*"+"*/
+    {    46,  0,  9,  2,  3,  6 }, /*","*/
+    {    47,  0,  5,  5,  1,  6 }, /*"-"*/
+    {    48,  1,  9,  1,  1,  6 }, /*"."*/
+    {    49,  0,  1,  5, 10,  6 }, /*"/"*/
+    {    56,  0,  2,  5,  8,  6 }, /*"0"*/
+    {    61,  1,  2,  3,  8,  6 }, /*"1"*/
+    {    64,  0,  2,  5,  8,  6 }, /*"2"*/
+    {    69,  0,  2,  5,  8,  6 }, /*"3"*/
+    {    74,  0,  2,  5,  8,  6 }, /*"4"*/
+    {    79,  0,  2,  5,  8,  6 }, /*"5"*/
+    {    84,  0,  2,  5,  8,  6 }, /*"6"*/
+    {    89,  0,  2,  5,  8,  6 }, /*"7"*/
+    {    94,  0,  2,  5,  8,  6 }, /*"8"*/
+    {    99,  0,  2,  5,  8,  6 }, /*"9"*/
+    {   104,  2,  4,  1,  6,  6 }, /*":"*/
+    {   105,  2,  5,  1,  6,  6 }, /*";"*/
+    {   106,  1,  1,  5,  9,  6 }, /*"<"*/
+    {   112,  0,  4,  5,  4,  6 }, /*"="*/
+    {   115,  1,  1,  5,  9,  6 }, /*">"*/
+    {   121,  0,  2,  5,  8,  6 }, /*"?"*/
+    {   126,  0,  2,  5,  8,  6 }, /*"@"*/
+    {   131,  0,  2,  6,  8,  6 }, /*"A"*/
+    {   137,  0,  2,  5,  8,  6 }, /*"B"*/
+    {   142,  0,  2,  5,  8,  6 }, /*"C"*/
+    {   147,  0,  2,  5,  8,  6 }, /*"D"*/
+    {   152,  0,  2,  5,  8,  6 }, /*"E"*/
+    {   157,  0,  2,  5,  8,  6 }, /*"F"*/
+    {   162,  0,  2,  6,  8,  6 }, /*"G"*/
+    {   168,  0,  2,  6,  8,  6 }, /*"H"*/
+    {   174,  0,  2,  5,  8,  6 }, /*"I"*/
+    {   179,  0,  2,  6,  9,  6 }, /*"J"*/
+    {   186,  0,  2,  6,  8,  6 }, /*"K"*/
+    {   192,  0,  2,  6,  8,  6 }, /*"L"*/
+    {   198,  0,  2,  5,  8,  6 }, /*"M"*/
+    {   203,  0,  2,  6,  8,  6 }, /*"N"*/
+    {   209,  0,  2,  5,  8,  6 }, /*"O"*/
+    {   214,  0,  2,  5,  8,  6 }, /*"P"*/
+    {   219,  0,  2,  5,  9,  6 }, /*"Q"*/
+    {   225,  0,  2,  6,  8,  6 }, /*"R"*/
+    {   231,  0,  2,  5,  8,  6 }, /*"S"*/
+    {   236,  0,  2,  5,  8,  6 }, /*"T"*/
+    {   241,  0,  2,  6,  8,  6 }, /*"U"*/
+    {   247,  0,  2,  6,  8,  6 }, /*"V"*/
+    {   253,  0,  2,  5,  8,  6 }, /*"W"*/
+    {   258,  0,  2,  5,  8,  6 }, /*"X"*/
+    {   263,  0,  2,  5,  8,  6 }, /*"Y"*/
+    {   268,  0,  2,  5,  8,  6 }, /*"Z"*/
+    {   273,  2,  1,  3, 10,  6 }, /*"["*/
+    {   277,  1,  1,  4,  9,  6 }, /*"\"*/
+    {   282,  1,  1,  3, 10,  6 }, /*"]"*/
+    {   286,  1,  1,  3,  2,  6 }, /*"^"*/
+    {   287,  0, 11,  6,  1,  6 }, /*"_"*/
+    {   288,  2,  1,  1,  1,  6 }, /*"`"*/
+    {   289,  1,  5,  5,  5,  6 }, /*"a"*/
+    {   293,  0,  2,  5,  8,  6 }, /*"b"*/
+    {   298,  1,  5,  4,  5,  6 }, /*"c"*/
+    {   301,  1,  2,  5,  8,  6 }, /*"d"*/
+    {   306,  1,  5,  4,  5,  6 }, /*"e"*/
+    {   309,  1,  2,  5,  8,  6 }, /*"f"*/
+    {   314,  1,  5,  5,  7,  6 }, /*"g"*/
+    {   319,  0,  2,  6,  8,  6 }, /*"h"*/
+    {   325,  1,  2,  3,  8,  6 }, /*"i"*/
+    {   328,  0,  2,  4, 10,  6 }, /*"j"*/
+    {   333,  0,  2,  6,  8,  6 }, /*"k"*/
+    {   339,  0,  2,  5,  8,  6 }, /*"l"*/
+    {   344,  0,  5,  5,  5,  6 }, /*"m"*/
+    {   348,  0,  5,  6,  5,  6 }, /*"n"*/
+    {   352,  1,  5,  4,  5,  6 }, /*"o"*/
+    {   355,  0,  5,  5,  7,  6 }, /*"p"*/
+    {   360,  1,  5,  5,  7,  6 }, /*"q"*/
+    {   365,  0,  5,  5,  5,  6 }, /*"r"*/
+    {   369,  1,  5,  4,  5,  6 }, /*"s"*/
+    {   372,  1,  3,  4,  7,  6 }, /*"t"*/
+    {   376,  0,  5,  6,  5,  6 }, /*"u"*/
+    {   380,  0,  5,  6,  5,  6 }, /*"v"*/
+    {   384,  0,  5,  5,  5,  6 }, /*"w"*/
+    {   388,  0,  5,  5,  5,  6 }, /*"x"*/
+    {   392,  0,  5,  6,  7,  6 }, /*"y"*/
+    {   398,  1,  5,  4,  5,  6 }, /*"z"*/
+    {   401,  2,  1,  3, 10,  6 }, /*"{"*/
+    {   405,  3,  0,  1, 12,  6 }, /*"|"*/
+    {   407,  1,  1,  3, 10,  6 }, /*"}"*/
+    {   411,  0,  0,  6,  3,  6 }, /*"~"*/
+};
+
+static const u8 font12_bits[417] = {
+    0xbf, 0x5a, 0x05, 0x14, 0xf5, 0x53, 0xca, 0xaf, 0x28, 0xc4, 0xd7, 0x62,
+    0x18, 0xad, 0x8f, 0x00, 0x52, 0xd5, 0x28, 0x14, 0xab, 0x4a, 0x84, 0xa2,
+    0x78, 0x55, 0x95, 0xd8, 0x1a, 0x54, 0x92, 0x24, 0x22, 0x11, 0x49, 0x92,
+    0x0a, 0xa4, 0x3a, 0x57, 0x09, 0x84, 0x90, 0x4f, 0x08, 0x01, 0x1a, 0x1f,
+    0x01, 0x10, 0x21, 0x44, 0x88, 0x10, 0x22, 0x00, 0x2e, 0xc6, 0x18, 0x63,
+    0x74, 0x9a, 0x24, 0xe9, 0x2e, 0x46, 0x44, 0x44, 0xf8, 0x2e, 0x42, 0x06,
+    0x61, 0x74, 0x88, 0x29, 0x95, 0x3c, 0xc2, 0x3f, 0x84, 0x07, 0x61, 0x74,
+    0x2e, 0x85, 0x17, 0x63, 0x74, 0x3f, 0x21, 0x42, 0x08, 0x21, 0x2e, 0x46,
+    0x17, 0x63, 0x74, 0x2e, 0xc6, 0xe8, 0xa1, 0x74, 0x21, 0x31, 0x10, 0x11,
+    0x11, 0x04, 0x41, 0x10, 0x1f, 0x80, 0x0f, 0x41, 0x10, 0x04, 0x11, 0x11,
+    0x01, 0x2e, 0x46, 0x44, 0x08, 0x20, 0x2e, 0xe6, 0x5a, 0x7b, 0xf0, 0x04,
+    0xc1, 0x28, 0x8a, 0x27, 0xcd, 0x4f, 0x4a, 0x27, 0xa5, 0x7c, 0x3e, 0x86,
+    0x10, 0x42, 0x74, 0x4f, 0x4a, 0x29, 0xa5, 0x7c, 0x5f, 0x2a, 0xa7, 0x84,
+    0xfc, 0x5f, 0x2a, 0xa7, 0x84, 0x38, 0x9c, 0x14, 0x04, 0x79, 0x24, 0x31,
+    0xb3, 0x24, 0x79, 0x92, 0x24, 0xcd, 0x9f, 0x10, 0x42, 0x08, 0xf9, 0x3e,
+    0x82, 0x20, 0x08, 0x82, 0x24, 0x07, 0xb7, 0xa4, 0x18, 0x8a, 0x22, 0xdd,
+    0x87, 0x20, 0x08, 0x82, 0x20, 0xfe, 0x7b, 0xef, 0x5d, 0x6b, 0xad, 0xbb,
+    0x64, 0x59, 0x9a, 0x26, 0x5d, 0x2e, 0xc6, 0x18, 0x63, 0x74, 0x4f, 0x4a,
+    0x27, 0x84, 0x38, 0x2e, 0xc6, 0x18, 0x6f, 0x76, 0x18, 0x8f, 0x24, 0x39,
+    0x8a, 0x24, 0xdd, 0x3e, 0x06, 0x83, 0x60, 0x7c, 0xbf, 0x12, 0x42, 0x08,
+    0x71, 0xb3, 0x24, 0x49, 0x92, 0x24, 0x31, 0xb3, 0x24, 0x29, 0x0a, 0x43,
+    0x10, 0xb5, 0x56, 0xa7, 0x94, 0x52, 0x5b, 0x29, 0x42, 0x94, 0xda, 0x5b,
+    0x29, 0x42, 0x08, 0x71, 0x3f, 0x21, 0x42, 0x84, 0xfc, 0x4f, 0x92, 0x24,
+    0x39, 0x11, 0x21, 0x42, 0x44, 0x08, 0x27, 0x49, 0x92, 0x3c, 0x2a, 0x3f,
+    0x01, 0x26, 0xb9, 0xe4, 0x01, 0x43, 0x08, 0x27, 0xa5, 0x74, 0x9e, 0x11,
+    0x0e, 0x0c, 0x21, 0x97, 0x52, 0xf2, 0x96, 0x1f, 0x0e, 0x5c, 0x88, 0x27,
+    0x84, 0x78, 0x3e, 0x99, 0xf0, 0xa2, 0x03, 0x83, 0x20, 0x38, 0x92, 0x24,
+    0xdd, 0x02, 0x26, 0xe9, 0x08, 0xc0, 0x88, 0x88, 0x78, 0x83, 0x20, 0xe8,
+    0x8a, 0x23, 0xdd, 0x87, 0x10, 0x42, 0x08, 0xf9, 0xaf, 0xd6, 0x5a, 0x01,
+    0x8f, 0x24, 0x49, 0x37, 0x96, 0x99, 0x06, 0x4f, 0x4a, 0xe9, 0xc4, 0x01,
+    0x2e, 0xa5, 0xe4, 0x10, 0x07, 0xdb, 0x08, 0x71, 0x00, 0x1f, 0x86, 0x0f,
+    0x22, 0x27, 0x22, 0x0c, 0x9b, 0x24, 0x49, 0x3c, 0xb7, 0xa4, 0x30, 0x04,
+    0xb5, 0x3a, 0xa5, 0x00, 0x5b, 0x11, 0xb5, 0x01, 0xb7, 0xa4, 0x30, 0x04,
+    0x31, 0x00, 0x4f, 0x22, 0x0f, 0x96, 0x14, 0x49, 0x32, 0xff, 0x0f, 0x93,
+    0x44, 0x49, 0x1a, 0x42, 0x89, 0x01, 0x00, 0x00, 0x00
+};
+
+const lcd_font_t lcd_font12 = {
+    12, 12, ' ', 95, 0,
+    font12_map, font12_glyphs, font12_bits, 0
+};
+
+//16 pixels high, fixed width, 95 glyphs
+static const u8 font16_map[95] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b,
+    0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+    0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20, 0x21, 0x22, 0x23,
+    0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b,
+    0x3c, 0x3d, 0x3e, 0x3f, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50, 0x51, 0x52, 0x53,
+    0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e
+};
+
+static const lcd_glyph_t font16_glyphs[95] = {
+    //offset  x   y   w   h  advance
+    {     0,  0,  0,  0,  0,  8 }, /*" "*/
+    {     0,  3,  3,  2, 11,  8 }, /*"!"*/
+    {     3,  3,  1,  5,  6,  8 }, /*"""*/
+    {     7,  0,  3,  7, 11,  8 }, /*"#"*/
+    {    17,  1,  2,  5, 14,  8 }, /*"$"*/
+    {    26,  1,  1,  7, 14,  8 }, /*"%"*/
+    {    39,  0,  3,  8, 11,  8 }, /*"&"*/
+    {    50,  6,  1,  2,  6,  8 }, /*"'"*/
+    {    52,  3,  1,  4, 14,  8 }, /*"("*/
+    {    59,  1,  1,  4, 14,  8 }, /*")"*/
+    {    66,  0,  4,  7,  8,  8 }, /*"*"*/
+    {    73,  0,  4,  7,  9,  8 }, /*"+"*/
+    {    81,  0, 12,  3,  4,  8 }, /*","*/
+    {    83,  1,  8,  7,  1,  8 }, /*"-"*/
+    {    84,  1, 12,  2,  2,  8 }, /*"."*/
+    {    85,  1,  2,  7, 13,  8 }, /*"/"*/
+    {    97,  1,  1,  7, 14,  8 }, /*"0"*/
+    {   110,  1,  1,  7, 14,  8 }, /*"1"*/
+    {   123,  1,  1,  7, 14,  8 }, /*"2"*/
+    {   136,  1,  1,  7, 14,  8 }, /*"3"*/
+    {   149,  1,  1,  7, 14,  8 }, /*"4"*/
+    {   162,  1,  1,  7, 14,  8 }, /*"5"*/
+    {   175,  1,  1,  7, 14,  8 }, /*"6"*/
+    {   188,  1,  1,  7, 14,  8 }, /*"7"*/
+    {   201,  1,  1,  7, 14,  8 }, /*"8"*/
+    {   214,  1,  1,  7, 14,  8 }, /*"9"*/
+    {   227,  3,  6,  2,  8,  8 }, /*":"*/
+    {   229,  2,  7,  2,  9,  8 }, /*";"*/
+    {   232,  1,  3,  6, 11,  8 }, /*"<"*/
+    {   241,  0,  6,  7,  5,  8 }, /*"="*/
+    {   246,  1,  3,  6, 11,  8 }, /*">"*/
+    {   255,  1,  1,  7, 14,  8 }, /*"?"*/
+    {   268,  0,  3,  7, 11,  8 }, /*"@"*/
+    {   278,  1,  1,  7, 14,  8 }, /*"A"*/
+    {   291,  1,  1,  7, 14,  8 }, /*"B"*/
+    {   304,  1,  1,  7, 14,  8 }, /*"C"*/
+    {   317,  1,  1,  7, 14,  8 }, /*"D"*/
+    {   330,  1,  1,  7, 14,  8 }, /*"E"*/
+    {   343,  1,  1,  7, 14,  8 }, /*"F"*/
+    {   356,  1,  1,  7, 14,  8 }, /*"G"*/
+    {   369,  1,  1,  7, 14,  8 }, /*"H"*/
+    {   382,  1,  1,  7, 14,  8 }, /*"I"*/
+    {   395,  1,  1,  7, 14,  8 }, /*"J"*/
+    {   408,  1,  1,  6, 14,  8 }, /*"K"*/
+    {   419,  1,  1,  7, 14,  8 }, /*"L"*/
+    {   432,  1,  1,  7, 14,  8 }, /*"M"*/
+    {   445,  1,  1,  7, 14,  8 }, /*"N"*/
+    {   458,  1,  1,  7, 14,  8 }, /*"O"*/
+    {   471,  1,  1,  7, 14,  8 }, /*"P"*/
+    {   484,  1,  1,  7, 14,  8 }, /*"Q"*/
+    {   497,  1,  1,  7, 14,  8 }, /*"R"*/
+    {   510,  1,  1,  7, 14,  8 }, /*"S"*/
+    {   523,  1,  1,  7, 14,  8 }, /*"T"*/
+    {   536,  1,  1,  7, 14,  8 }, /*"U"*/
+    {   549,  1,  2,  7, 13,  8 }, /*"V"*/
+    {   561,  1,  1,  7, 14,  8 }, /*"W"*/
+    {   574,  1,  1,  7, 14,  8 }, /*"X"*/
+    {   587,  1,  1,  7, 14,  8 }, /*"Y"*/
+    {   600,  0,  3,  7, 11,  8 }, /*"Z"*/
+    {   610,  3,  1,  4, 14,  8 }, /*"["*/
+    {   617,  1,  2,  6, 14,  8 }, /*"\"*/
+    {   628,  1,  1,  4, 14,  8 }, /*"]"*/
+    {   635,  4,  1,  4,  7,  8 }, /*"^"*/
+    {   639,  0, 15,  8,  1,  8 }, /*"_"*/
+    {   640,  1,  1,  3,  2,  8 }, /*"`"*/
+    {   641,  1,  1,  7, 14,  8 }, /*"a"*/
+    {   654,  1,  1,  7, 14,  8 }, /*"b"*/
+    {   667,  1,  1,  7, 14,  8 }, /*"c"*/
+    {   680,  1,  1,  7, 14,  8 }, /*"d"*/
+    {   693,  1,  1,  7, 14,  8 }, /*"e"*/
+    {   706,  1,  1,  7, 14,  8 }, /*"f"*/
+    {   719,  1,  1,  7, 14,  8 }, /*"g"*/
+    {   732,  1,  1,  7, 14,  8 }, /*"h"*/
+    {   745,  1,  1,  7, 14,  8 }, /*"i"*/
+    {   758,  1,  1,  7, 14,  8 }, /*"j"*/
+    {   771,  1,  1,  6, 14,  8 }, /*"k"*/
+    {   782,  1,  1,  7, 14,  8 }, /*"l"*/
+    {   795,  1,  1,  7, 14,  8 }, /*"m"*/
+    {   808,  1,  1,  7, 14,  8 }, /*"n"*/
+    {   821,  1,  1,  7, 14,  8 }, /*"o"*/
+    {   834,  1,  1,  7, 14,  8 }, /*"p"*/
+    {   847,  1,  1,  7, 14,  8 }, /*"q"*/
+    {   860,  1,  1,  7, 14,  8 }, /*"r"*/
+    {   873,  1,  1,  7, 14,  8 }, /*"s"*/
+    {   886,  1,  1,  7, 14,  8 }, /*"t"*/
+    {   899,  1,  1,  7, 14,  8 }, /*"u"*/
+    {   912,  1,  2,  7, 13,  8 }, /*"v"*/
+    {   924,  1,  1,  7, 14,  8 }, /*"w"*/
+    {   937,  1,  1,  7, 14,  8 }, /*"x"*/
+    {   950,  1,  1,  7, 14,  8 }, /*"y"*/
+    {   963,  1,  7,  6,  7,  8 }, /*"z"*/
+    {   969,  4,  1,  4, 14,  8 }, /*"{"*/
+    {   976,  4,  0,  1, 16,  8 }, /*"|"*/
+    {   978,  1,  1,  4, 14,  8 }, /*"}"*/
+    {   985,  1,  0,  7,  3,  8 }, /*"~"*/
+};
+
+static const u8 font16_bits[991] = {
+    0x55, 0x15, 0x3c, 0x69, 0xef, 0xbd, 0x25, 0x24, 0x12, 0xe9, 0x2f, 0x91,
+    0x48, 0xfe, 0x12, 0x89, 0x04, 0xc4, 0xd5, 0x5a, 0x0c, 0xa3, 0xb4, 0x56,
+    0x47, 0x08, 0xa3, 0x31, 0x18, 0x0c, 0x06, 0x7b, 0x7f, 0x83, 0xc1, 0x60,
+    0x30, 0x16, 0x03, 0x0c, 0x12, 0x12, 0x12, 0x0a, 0x76, 0x25, 0x29, 0x11,
+    0x91, 0x6e, 0xfd, 0x0b, 0x48, 0x22, 0x11, 0x11, 0x11, 0x22, 0x84, 0x21,
+    0x44, 0x88, 0x88, 0x88, 0x44, 0x12, 0x08, 0xc4, 0x9a, 0xc3, 0x59, 0x23,
+    0x10, 0x08, 0x04, 0x02, 0xf1, 0x47, 0x20, 0x10, 0x08, 0x36, 0x07, 0x7f,
+    0x0f, 0x40, 0x10, 0x08, 0x02, 0x41, 0x20, 0x08, 0x04, 0x81, 0x20, 0x10,
+    0x00, 0xbf, 0xef, 0x78, 0x3c, 0x1e, 0x0b, 0xc3, 0xe3, 0xf1, 0x78, 0xdc,
+    0xff, 0x03, 0x0f, 0x0f, 0x06, 0x83, 0xc1, 0x20, 0x20, 0x18, 0x0c, 0x06,
+    0xe3, 0xfb, 0x03, 0x3f, 0x2f, 0x18, 0x0c, 0x06, 0x7b, 0x7f, 0x83, 0xc1,
+    0x60, 0xd0, 0xfb, 0x03, 0x3f, 0x3f, 0x18, 0x0c, 0x06, 0x73, 0x7d, 0x60,
+    0x30, 0x18, 0xec, 0xfd, 0x01, 0xc1, 0xf1, 0x78, 0x3c, 0x1e, 0xf7, 0xbd,
+    0x60, 0x30, 0x18, 0x0c, 0x06, 0x02, 0xff, 0xdf, 0x60, 0x30, 0x18, 0xfc,
+    0xbc, 0x60, 0x30, 0x18, 0xec, 0xff, 0x03, 0xff, 0xdf, 0x60, 0x30, 0x18,
+    0xfc, 0xfa, 0xe3, 0xf1, 0x78, 0xdc, 0xff, 0x03, 0x7f, 0x1f, 0x10, 0x0c,
+    0x06, 0x03, 0x41, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x02, 0xbf, 0xef, 0x78,
+    0x3c, 0x1e, 0xfb, 0x38, 0xa3, 0xf1, 0x78, 0xdc, 0xf7, 0x01, 0xbf, 0xef,
+    0x78, 0x3c, 0x1e, 0x7f, 0x7d, 0x60, 0x30, 0x18, 0xec, 0xfd, 0x03, 0x0f,
+    0xf0, 0x02, 0xa0, 0x01, 0x20, 0x84, 0x10, 0x42, 0x20, 0x10, 0x08, 0x04,
+    0x02, 0x7f, 0x00, 0x00, 0xf0, 0x07, 0x81, 0x40, 0x20, 0x10, 0x08, 0x21,
+    0x84, 0x10, 0x00, 0xbf, 0xee, 0x78, 0x1c, 0x06, 0xf3, 0x69, 0x0c, 0x06,
+    0x83, 0x80, 0x60, 0x00, 0x1c, 0x91, 0xb6, 0x5a, 0xad, 0x56, 0x5b, 0x42,
+    0x11, 0x07, 0xbe, 0xee, 0x78, 0x3c, 0x1e, 0xff, 0xfb, 0xe3, 0xf1, 0x78,
+    0x3c, 0x0e, 0x02, 0xbf, 0xfe, 0x78, 0x3c, 0x1e, 0xff, 0x3e, 0xa3, 0xf1,
+    0x78, 0xdc, 0xff, 0x01, 0xfe, 0xde, 0x60, 0x30, 0x18, 0x04, 0x06, 0x83,
+    0xc1, 0x60, 0xd0, 0xf3, 0x03, 0xbf, 0xfe, 0x78, 0x3c, 0x1e, 0x87, 0x87,
+    0xe3, 0xf1, 0x78, 0xdc, 0xff, 0x01, 0xff, 0xde, 0x60, 0x30, 0x18, 0xf4,
+    0x3c, 0x83, 0xc1, 0x60, 0xd0, 0xfb, 0x03, 0xff, 0xde, 0x60, 0x30, 0x08,
+    0x38, 0x3a, 0x83, 0xc1, 0x60, 0x30, 0x08, 0x00, 0xbe, 0xfe, 0x60, 0x30,
+    0x18, 0xc4, 0x75, 0xc3, 0xf1, 0x78, 0xfc, 0xf5, 0x01, 0xc1, 0xf1, 0x78,
+    0x3c, 0x1e, 0x7f, 0x7b, 0xe3, 0xf1, 0x78, 0x3c, 0x0e, 0x02, 0x7f, 0x1f,
+    0x02, 0x83, 0xc1, 0x40, 0x10, 0x18, 0x0c, 0x06, 0x61, 0xfb, 0x03, 0x78,
+    0x38, 0x10, 0x0c, 0x06, 0x83, 0x80, 0x60, 0x30, 0x18, 0xfc, 0xf5, 0x01,
+    0xe1, 0x3c, 0xcf, 0xf3, 0xf4, 0x74, 0xf3, 0x3c, 0xcf, 0x73, 0x08, 0x81,
+    0xc1, 0x60, 0x30, 0x18, 0x04, 0x06, 0x83, 0xc1, 0x60, 0xd0, 0xfb, 0x03,
+    0xff, 0xef, 0x7a, 0xbd, 0x5e, 0x0f, 0x45, 0xe3, 0xf1, 0x78, 0x3c, 0x0e,
+    0x02, 0xff, 0xef, 0x78, 0x3c, 0x1e, 0x8b, 0x83, 0xe3, 0xf1, 0x78, 0x3c,
+    0x1e, 0x03, 0xbf, 0xef, 0x78, 0x3c, 0x1e, 0x0b, 0xc3, 0xe3, 0xf1, 0x78,
+    0xdc, 0xff, 0x03, 0xbf, 0xfe, 0x78, 0x3c, 0x1e, 0xff, 0x7a, 0x83, 0xc1,
+    0x60, 0x30, 0x08, 0x00, 0xff, 0xee, 0x78, 0x3c, 0x1e, 0x8f, 0x45, 0xe3,
+    0xf1, 0x7a, 0xdd, 0xfd, 0x03, 0xbf, 0xef, 0x78, 0x3c, 0x1e, 0xff, 0x3a,
+    0x9b, 0xdd, 0x6c, 0x3c, 0x0e, 0x02, 0xfe, 0xdf, 0x60, 0x30, 0x18, 0xf4,
+    0xbc, 0x60, 0x30, 0x18, 0xec, 0xfd, 0x01, 0x7f, 0x1f, 0x02, 0x83, 0xc1,
+    0x60, 0x20, 0x18, 0x0c, 0x06, 0x83, 0x41, 0x00, 0xc1, 0xf1, 0x78, 0x3c,
+    0x1e, 0x87, 0x85, 0xe3, 0xf1, 0x78, 0xfc, 0xf7, 0x01, 0xc1, 0xf1, 0x78,
+    0x3c, 0x0e, 0x93, 0xd9, 0x6c, 0x36, 0x1a, 0x0e, 0x03, 0xc1, 0xf1, 0x78,
+    0x3c, 0x1e, 0x07, 0x47, 0xeb, 0xf5, 0x7a, 0xdd, 0xfd, 0x03, 0xc1, 0xf1,
+    0x78, 0x3c, 0x1e, 0xfa, 0x38, 0xa2, 0xf1, 0x78, 0x3c, 0x0e, 0x02, 0xc1,
+    0xf1, 0x78, 0x3c, 0x1e, 0xf7, 0xbc, 0x60, 0x30, 0x18, 0xcc, 0xc5, 0x01,
+    0xfe, 0x10, 0x08, 0x02, 0x41, 0x10, 0x08, 0x42, 0xe1, 0x0f, 0x1f, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0xf1, 0x41, 0x20, 0x08, 0x04, 0x41, 0x20, 0x08,
+    0x04, 0x41, 0x20, 0x08, 0x8f, 0x88, 0x88, 0x88, 0x88, 0x88, 0xf8, 0xd6,
+    0xdd, 0xdd, 0x06, 0xff, 0x23, 0xbe, 0xee, 0x78, 0x3c, 0x1e, 0xff, 0xfb,
+    0xe3, 0xf1, 0x78, 0x3c, 0x0e, 0x02, 0xbf, 0xfe, 0x78, 0x3c, 0x1e, 0xff,
+    0x3e, 0xa3, 0xf1, 0x78, 0xdc, 0xff, 0x01, 0xfe, 0xde, 0x60, 0x30, 0x18,
+    0x04, 0x06, 0x83, 0xc1, 0x60, 0xd0, 0xf3, 0x03, 0xbf, 0xfe, 0x78, 0x3c,
+    0x1e, 0x87, 0x87, 0xe3, 0xf1, 0x78, 0xdc, 0xff, 0x01, 0xff, 0xde, 0x60,
+    0x30, 0x18, 0xf4, 0x3c, 0x83, 0xc1, 0x60, 0xd0, 0xfb, 0x03, 0xff, 0xde,
+    0x60, 0x30, 0x08, 0x38, 0x3a, 0x83, 0xc1, 0x60, 0x30, 0x08, 0x00, 0xbe,
+    0xfe, 0x60, 0x30, 0x18, 0xc4, 0x75, 0xc3, 0xf1, 0x78, 0xfc, 0xf5, 0x01,
+    0xc1, 0xf1, 0x78, 0x3c, 0x1e, 0x7f, 0x7b, 0xe3, 0xf1, 0x78, 0x3c, 0x0e,
+    0x02, 0x7f, 0x1f, 0x02, 0x83, 0xc1, 0x40, 0x10, 0x18, 0x0c, 0x06, 0x61,
+    0xfb, 0x03, 0x78, 0x38, 0x10, 0x0c, 0x06, 0x83, 0x80, 0x60, 0x30, 0x18,
+    0xfc, 0xf5, 0x01, 0xe1, 0x3c, 0xcf, 0xf3, 0xf4, 0x74, 0xf3, 0x3c, 0xcf,
+    0x73, 0x08, 0x81, 0xc1, 0x60, 0x30, 0x18, 0x04, 0x06, 0x83, 0xc1, 0x60,
+    0xd0, 0xfb, 0x03, 0xff, 0xef, 0x7a, 0xbd, 0x5e, 0x0f, 0x45, 0xe3, 0xf1,
+    0x78, 0x3c, 0x0e, 0x02, 0xff, 0xef, 0x78, 0x3c, 0x1e, 0x8b, 0x83, 0xe3,
+    0xf1, 0x78, 0x3c, 0x1e, 0x03, 0xbf, 0xef, 0x78, 0x3c, 0x1e, 0x0b, 0xc3,
+    0xe3, 0xf1, 0x78, 0xdc, 0xff, 0x03, 0xbf, 0xfe, 0x78, 0x3c, 0x1e, 0xff,
+    0x7a, 0x83, 0xc1, 0x60, 0x30, 0x08, 0x00, 0xff, 0xee, 0x78, 0x3c, 0x1e,
+    0x8f, 0x45, 0xe3, 0xf1, 0x7a, 0xdd, 0xfd, 0x03, 0xbf, 0xef, 0x78, 0x3c,
+    0x1e, 0xff, 0x3a, 0x9b, 0xdd, 0x6c, 0x3c, 0x0e, 0x02, 0xfe, 0xdf, 0x60,
+    0x30, 0x18, 0xf4, 0xbc, 0x60, 0x30, 0x18, 0xec, 0xfd, 0x01, 0x7f, 0x1f,
+    0x02, 0x83, 0xc1, 0x60, 0x20, 0x18, 0x0c, 0x06, 0x83, 0x41, 0x00, 0xc1,
+    0xf1, 0x78, 0x3c, 0x1e, 0x87, 0x85, 0xe3, 0xf1, 0x78, 0xfc, 0xf7, 0x01,
+    0xc1, 0xf1, 0x78, 0x3c, 0x0e, 0x93, 0xd9, 0x6c, 0x36, 0x1a, 0x0e, 0x03,
+    0xc1, 0xf1, 0x78, 0x3c, 0x1e, 0x07, 0x47, 0xeb, 0xf5, 0x7a, 0xdd, 0xfd,
+    0x03, 0xc1, 0xf1, 0x78, 0x3c, 0x1e, 0xfa, 0x38, 0xa2, 0xf1, 0x78, 0x3c,
+    0x0e, 0x02, 0xc1, 0xf1, 0x78, 0x3c, 0x1e, 0xf7, 0xbc, 0x60, 0x30, 0x18,
+    0xcc, 0xc5, 0x01, 0x7f, 0x84, 0x10, 0x84, 0xf8, 0x03, 0x2c, 0x22, 0x22,
+    0x21, 0x22, 0x22, 0xc2, 0xff, 0xff, 0x43, 0x44, 0x44, 0x48, 0x44, 0x44,
+    0x34, 0x86, 0x4c, 0x18, 0x00, 0x00, 0x00
+};
+
+const lcd_font_t lcd_font16 = {
+    16, 16, ' ', 95, 0,
+    font16_map, font16_glyphs, font16_bits, 0
+};
+
+//32 pixels high, fixed width, 15 glyphs
+static const u8 font32_map[63] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+    0x0a, 0x0b, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0e
+};
+
+static const lcd_glyph_t font32_glyphs[15] = {
+    //offset  x   y   w   h  advance
+    {     0,  0,  0,  0,  0, 16 }, /*" "*/
+    {     0,  1,  6, 15, 21, 16 }, /*"%"*/
+    {    40,  1,  1, 15, 30, 16 }, /*"0"*/
+    {    97,  2,  1, 14, 30, 16 }, /*"1"*/
+    {   150,  1,  1, 15, 30, 16 }, /*"2"*/
+    {   207,  2,  1, 14, 30, 16 }, /*"3"*/
+    {   260,  1,  2, 15, 28, 16 }, /*"4"*/
+    {   313,  1,  1, 15, 30, 16 }, /*"5"*/
+    {   370,  1,  1, 15, 30, 16 }, /*"6"*/
+    {   427,  1,  1, 15, 30, 16 }, /*"7"*/
+    {   484,  1,  1, 15, 30, 16 }, /*"8"*/
+    {   541,  1,  1, 15, 30, 16 }, /*"9"*/
+    {   598,  5,  5,  6, 22, 16 }, /*":"*/
+    {   615,  0,  6, 15, 21, 16 }, /*"F"*/
+    {   655,  3,  3,  9,  4, 16 }, /*"^"*/
+};
+
+static const u8 font32_bits[663] = {
+    0x04, 0x1c, 0x06, 0x1b, 0xc2, 0x18, 0x63, 0x0c, 0x31, 0x86, 0x18, 0x83,
+    0x8c, 0x41, 0xc6, 0x40, 0x63, 0x2e, 0x9b, 0x3d, 0x47, 0x14, 0x30, 0x0e,
+    0x18, 0x0b, 0x8c, 0x05, 0xc6, 0x04, 0x63, 0x82, 0x31, 0x83, 0x08, 0xc1,
+    0x86, 0xc1, 0x81, 0x00, 0xfe, 0xbf, 0xfe, 0xef, 0xfe, 0xfb, 0xfe, 0xfe,
+    0x80, 0x7f, 0xc0, 0x3f, 0xe0, 0x1f, 0xf0, 0x0f, 0xf8, 0x07, 0xbc, 0x03,
+    0xae, 0x01, 0xbb, 0x80, 0x3e, 0x80, 0x1f, 0xc0, 0x17, 0xd0, 0x0d, 0x58,
+    0x07, 0xdc, 0x03, 0xfe, 0x01, 0xff, 0x80, 0x7f, 0xc0, 0x3f, 0xe0, 0x1f,
+    0xf0, 0x0f, 0xf8, 0x07, 0xfc, 0xfd, 0x7d, 0xff, 0xdd, 0xff, 0xf5, 0xff,
+    0x01, 0xff, 0x80, 0x5f, 0xc0, 0x1b, 0x60, 0x07, 0xe0, 0x01, 0x78, 0x00,
+    0x1e, 0x80, 0x07, 0xe0, 0x01, 0x78, 0x00, 0x0e, 0x80, 0x05, 0xa0, 0x01,
+    0x70, 0x00, 0x1c, 0x80, 0x06, 0x60, 0x01, 0x38, 0x00, 0x1e, 0x80, 0x07,
+    0xe0, 0x01, 0x78, 0x00, 0x1e, 0x80, 0x07, 0xe0, 0x01, 0x38, 0x80, 0x75,
+    0xf0, 0x3e, 0xfe, 0xdf, 0xff, 0x0f, 0xff, 0x3f, 0xff, 0x2f, 0xff, 0x1b,
+    0xff, 0x0e, 0x80, 0x07, 0xc0, 0x03, 0xe0, 0x01, 0xf0, 0x00, 0x78, 0x00,
+    0x3c, 0x00, 0x1e, 0x00, 0x0f, 0x80, 0x83, 0xbf, 0xe0, 0x3f, 0xf0, 0x1f,
+    0xf4, 0x07, 0x07, 0xc0, 0x03, 0xe0, 0x01, 0xf0, 0x00, 0x78, 0x00, 0x3c,
+    0x00, 0x1e, 0x00, 0x0f, 0x80, 0x07, 0xc0, 0xfd, 0x63, 0xff, 0xd3, 0xff,
+    0xf3, 0xff, 0x03, 0xff, 0x9f, 0xff, 0xcf, 0xff, 0xe3, 0xff, 0x00, 0x3c,
+    0x00, 0x0f, 0xc0, 0x03, 0xf0, 0x00, 0x3c, 0x00, 0x0f, 0xc0, 0x01, 0xb0,
+    0xfc, 0x37, 0xfe, 0x0e, 0xbf, 0x83, 0xd7, 0x00, 0x2c, 0x00, 0x07, 0xc0,
+    0x03, 0xf0, 0x00, 0x3c, 0x00, 0x0f, 0xc0, 0x03, 0xf0, 0x00, 0x3c, 0x00,
+    0x8f, 0xbf, 0xf3, 0xdf, 0xfe, 0xef, 0xff, 0x07, 0x01, 0xc0, 0x01, 0xf0,
+    0x01, 0xfc, 0x01, 0xff, 0x80, 0x7f, 0xc0, 0x3f, 0xe0, 0x1f, 0xf0, 0x0f,
+    0x78, 0x07, 0x1c, 0x03, 0x16, 0xff, 0x0d, 0x7f, 0x07, 0xbf, 0x03, 0xbf,
+    0x01, 0xb0, 0x00, 0x38, 0x00, 0x3c, 0x00, 0x1e, 0x00, 0x0f, 0x80, 0x07,
+    0xc0, 0x03, 0xe0, 0x01, 0xf0, 0x00, 0x78, 0x00, 0x38, 0x00, 0x18, 0x00,
+    0x08, 0xfe, 0xff, 0xfe, 0xdf, 0xfe, 0xe7, 0xfe, 0xf1, 0x00, 0x78, 0x00,
+    0x3c, 0x00, 0x1e, 0x00, 0x0f, 0x80, 0x07, 0xc0, 0x03, 0xe0, 0x01, 0xe0,
+    0x00, 0xa0, 0x3f, 0xe0, 0x3f, 0xf0, 0x1f, 0xf0, 0x17, 0x00, 0x1c, 0x00,
+    0x1e, 0x00, 0x0f, 0x80, 0x07, 0xc0, 0x03, 0xe0, 0x01, 0xf0, 0x00, 0x78,
+    0x00, 0x3c, 0xfe, 0x9d, 0xff, 0xed, 0xff, 0xfd, 0xff, 0x01, 0xfe, 0xff,
+    0xfe, 0xdf, 0xfe, 0xe7, 0xfe, 0xf1, 0x00, 0x78, 0x00, 0x3c, 0x00, 0x1e,
+    0x00, 0x0f, 0x80, 0x07, 0x80, 0x03, 0xa0, 0x01, 0xb0, 0x00, 0x38, 0x3f,
+    0xfc, 0x3f, 0xfe, 0x3f, 0xe7, 0xbf, 0x05, 0x7c, 0x03, 0xde, 0x01, 0xff,
+    0x80, 0x7f, 0xc0, 0x3f, 0xe0, 0x1f, 0xf0, 0x0f, 0xf8, 0x07, 0xfc, 0xfd,
+    0x7d, 0xff, 0xdd, 0xff, 0xf5, 0xff, 0x01, 0xff, 0x3f, 0xff, 0x2f, 0xff,
+    0x1b, 0xff, 0x0e, 0x80, 0x07, 0xc0, 0x03, 0xe0, 0x01, 0xf0, 0x00, 0x78,
+    0x00, 0x3c, 0x00, 0x0e, 0x00, 0x0b, 0x80, 0x06, 0x80, 0x03, 0xe0, 0x01,
+    0xf0, 0x00, 0x70, 0x00, 0x34, 0x00, 0x16, 0x00, 0x07, 0x80, 0x07, 0xc0,
+    0x03, 0xe0, 0x01, 0xf0, 0x00, 0x78, 0x00, 0x3c, 0x00, 0x1e, 0x00, 0x0e,
+    0x00, 0x06, 0x00, 0x02, 0xfe, 0xbf, 0xfe, 0xef, 0xfe, 0xfb, 0xfe, 0xfe,
+    0x80, 0x7f, 0xc0, 0x3f, 0xe0, 0x1f, 0xf0, 0x0f, 0xf8, 0x07, 0xbc, 0x03,
+    0xae, 0x01, 0xbb, 0xbe, 0xbe, 0xbf, 0xdf, 0xdf, 0xd7, 0xd7, 0x0d, 0x58,
+    0x07, 0xdc, 0x03, 0xfe, 0x01, 0xff, 0x80, 0x7f, 0xc0, 0x3f, 0xe0, 0x1f,
+    0xf0, 0x0f, 0xf8, 0x07, 0xfc, 0xfd, 0x7d, 0xff, 0xdd, 0xff, 0xf5, 0xff,
+    0x01, 0xfe, 0xbf, 0xfe, 0xef, 0xfe, 0xfb, 0xfe, 0xfe, 0x80, 0x7f, 0xc0,
+    0x3f, 0xe0, 0x1f, 0xf0, 0x0f, 0xf8, 0x07, 0xfc, 0x03, 0xee, 0x01, 0xfb,
+    0x80, 0xf6, 0x9f, 0xf3, 0xff, 0xf1, 0xff, 0xf0, 0x73, 0x00, 0x34, 0x00,
+    0x16, 0x00, 0x07, 0x80, 0x07, 0xc0, 0x03, 0xe0, 0x01, 0xf0, 0x00, 0x78,
+    0x00, 0x3c, 0xfe, 0x9d, 0xff, 0xed, 0xff, 0xfd, 0xff, 0x01, 0xff, 0xff,
+    0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
+    0xff, 0xff, 0x0f, 0xfe, 0x7f, 0x07, 0x8c, 0x00, 0x66, 0x00, 0x13, 0x80,
+    0x01, 0xc0, 0x20, 0x60, 0x10, 0x30, 0x18, 0x18, 0xfc, 0x0f, 0x06, 0x06,
+    0x01, 0x83, 0x80, 0x01, 0xc0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00,
+    0x0c, 0x00, 0x06, 0x00, 0x03, 0xe0, 0x07, 0x3c, 0xd8, 0x08, 0x0a, 0x08,
+    0x00, 0x00, 0x00
+};
+
+const lcd_font_t lcd_font32 = {
+    32, 32, ' ', 63, 0,
+    font32_map, font32_glyphs, font32_bits, 0
+};
+
+//48 pixels high, fixed width, 12 glyphs
+static const u8 font48_map[27] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+    0x09, 0x0a, 0x0b
+};
+
+static const lcd_glyph_t font48_glyphs[12] = {
+    //offset  x   y   w   h  advance
+    {     0,  0,  0,  0,  0, 24 }, /*" "*/
+    {     0,  1,  2, 23, 45, 24 }, /*"0"*/
+    {   130,  2,  2, 22, 45, 24 }, /*"1"*/
+    {   254,  1,  2, 23, 45, 24 }, /*"2"*/
+    {   384,  3,  2, 21, 45, 24 }, /*"3"*/
+    {   503,  1,  3, 23, 42, 24 }, /*"4"*/
+    {   624,  1,  2, 23, 45, 24 }, /*"5"*/
+    {   754,  1,  2, 23, 45, 24 }, /*"6"*/
+    {   884,  1,  2, 23, 45, 24 }, /*"7"*/
+    {  1014,  1,  2, 23, 45, 24 }, /*"8"*/
+    {  1144,  1,  2, 23, 45, 24 }, /*"9"*/
+    {  1274,  7,  8,  9, 33, 24 }, /*":"*/
+};
+
+static const u8 font48_bits[1315] = {
+    0xfe, 0xff, 0xbf, 0xfe, 0xff, 0xef, 0xfe, 0xff, 0xfb, 0xfe, 0xff, 0xfe,
+    0xfe, 0xbf, 0xff, 0xfe, 0xef, 0xff, 0x00, 0xf8, 0x7f, 0x00, 0xfc, 0x3f,
+    0x00, 0xfe, 0x1f, 0x00, 0xff, 0x0f, 0x80, 0xff, 0x07, 0xc0, 0xff, 0x03,
+    0xe0, 0xff, 0x01, 0xf0, 0xff, 0x00, 0xf8, 0x7f, 0x00, 0xfc, 0x3e, 0x00,
+    0xbe, 0x1e, 0x00, 0xef, 0x0e, 0x80, 0xfb, 0x06, 0xc0, 0xfe, 0x02, 0xa0,
+    0xff, 0x00, 0xe0, 0xff, 0x00, 0xf8, 0x3f, 0x00, 0xf8, 0x2f, 0x00, 0xfa,
+    0x1b, 0x00, 0xfb, 0x0e, 0x80, 0xbb, 0x07, 0xc0, 0xeb, 0x03, 0xe0, 0xfb,
+    0x01, 0xf0, 0xff, 0x00, 0xf8, 0x7f, 0x00, 0xfc, 0x3f, 0x00, 0xfe, 0x1f,
+    0x00, 0xff, 0x0f, 0x80, 0xff, 0x07, 0xc0, 0xff, 0x03, 0xe0, 0xff, 0x01,
+    0xf0, 0xff, 0x00, 0xf8, 0xbf, 0xff, 0xfb, 0xef, 0xff, 0xfb, 0xfb, 0xff,
+    0xfb, 0xfe, 0xff, 0xbb, 0xff, 0xff, 0xeb, 0xff, 0xff, 0x03, 0xfe, 0x1f,
+    0x80, 0xff, 0x0b, 0xc0, 0x7f, 0x03, 0xe0, 0xef, 0x00, 0xf0, 0x3d, 0x00,
+    0xb8, 0x0f, 0x00, 0xf0, 0x03, 0x00, 0xfc, 0x00, 0x00, 0x3f, 0x00, 0xc0,
+    0x0f, 0x00, 0xf0, 0x03, 0x00, 0xfc, 0x00, 0x00, 0x3f, 0x00, 0xc0, 0x0f,
+    0x00, 0xf0, 0x03, 0x00, 0x7c, 0x00, 0x00, 0x2f, 0x00, 0xc0, 0x0d, 0x00,
+    0xb0, 0x03, 0x00, 0xf4, 0x00, 0x00, 0x3e, 0x00, 0x40, 0x0f, 0x00, 0xb0,
+    0x03, 0x00, 0xdc, 0x00, 0x00, 0x2f, 0x00, 0xc0, 0x07, 0x00, 0xf0, 0x03,
+    0x00, 0xfc, 0x00, 0x00, 0x3f, 0x00, 0xc0, 0x0f, 0x00, 0xf0, 0x03, 0x00,
+    0xfc, 0x00, 0x00, 0x3f, 0x00, 0xc0, 0x0f, 0x00, 0xf0, 0x03, 0x00, 0xfc,
+    0x00, 0x00, 0x3f, 0x00, 0xc0, 0x0f, 0x00, 0xe0, 0x01, 0xc0, 0xb7, 0x0f,
+    0xf8, 0xf3, 0x07, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff,
+    0xff, 0x3f, 0xff, 0xff, 0x1f, 0xfe, 0xff, 0x37, 0xff, 0xff, 0x1b, 0xff,
+    0x7f, 0x0e, 0xfe, 0xdf, 0x07, 0xff, 0xef, 0x03, 0x00, 0xf8, 0x01, 0x00,
+    0xfc, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x3f, 0x00, 0x80, 0x1f, 0x00, 0xc0,
+    0x0f, 0x00, 0xe0, 0x07, 0x00, 0xf0, 0x03, 0x00, 0xf8, 0x01, 0x00, 0xfc,
+    0x00, 0x00, 0x7e, 0x00, 0x00, 0x3f, 0x00, 0x80, 0x07, 0xf8, 0xbf, 0x01,
+    0xfc, 0xdf, 0x00, 0xff, 0x1f, 0x80, 0xff, 0x0f, 0xc0, 0xff, 0x07, 0xd8,
+    0xff, 0x01, 0x1e, 0x00, 0x00, 0x0f, 0x00, 0xe0, 0x07, 0x00, 0xf0, 0x03,
+    0x00, 0xf8, 0x01, 0x00, 0xfc, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x3f, 0x00,
+    0x80, 0x1f, 0x00, 0xc0, 0x0f, 0x00, 0xe0, 0x07, 0x00, 0xf0, 0x03, 0x00,
+    0xf8, 0x01, 0x00, 0xfc, 0x00, 0x00, 0xbe, 0xff, 0x07, 0xe7, 0xff, 0x8f,
+    0xf3, 0xff, 0xc7, 0xfe, 0xff, 0x87, 0xff, 0xff, 0xcf, 0xff, 0xff, 0x07,
+    0xff, 0xff, 0xc7, 0xff, 0xff, 0xfb, 0xff, 0x7f, 0xfc, 0xff, 0x0f, 0xff,
+    0xff, 0xe1, 0xff, 0x3f, 0x00, 0xe0, 0x07, 0x00, 0xfc, 0x00, 0x80, 0x1f,
+    0x00, 0xf0, 0x03, 0x00, 0x7e, 0x00, 0xc0, 0x0f, 0x00, 0xf8, 0x01, 0x00,
+    0x3f, 0x00, 0xe0, 0x07, 0x00, 0x3c, 0x00, 0x80, 0x1b, 0x00, 0x70, 0xe3,
+    0xff, 0x73, 0xf8, 0xbf, 0x0f, 0xff, 0xf7, 0x81, 0xff, 0x3e, 0xe0, 0x27,
+    0x07, 0xfc, 0xe4, 0x00, 0x80, 0x1b, 0x00, 0xf0, 0x00, 0x00, 0x1e, 0x00,
+    0xc0, 0x0f, 0x00, 0xf8, 0x01, 0x00, 0x3f, 0x00, 0xe0, 0x07, 0x00, 0xfc,
+    0x00, 0x80, 0x1f, 0x00, 0xf0, 0x03, 0x00, 0x7e, 0x00, 0xc0, 0x0f, 0x00,
+    0xf8, 0x01, 0x00, 0x3f, 0x00, 0xe0, 0x87, 0xff, 0xfb, 0xf8, 0xff, 0x1c,
+    0xff, 0x9f, 0xfb, 0xff, 0xef, 0xff, 0xff, 0xf3, 0xff, 0x7f, 0x00, 0x03,
+    0x00, 0xe0, 0x01, 0x00, 0xf0, 0x01, 0x00, 0xfc, 0x03, 0x80, 0xff, 0x01,
+    0xc0, 0xff, 0x01, 0xf0, 0xff, 0x00, 0xf8, 0x7f, 0x00, 0xfc, 0x3f, 0x00,
+    0xfe, 0x1f, 0x00, 0xff, 0x0f, 0x80, 0xff, 0x07, 0xc0, 0xff, 0x03, 0xe0,
+    0xff, 0x01, 0xf0, 0xf3, 0x00, 0x78, 0x70, 0x00, 0xdc, 0x38, 0x00, 0x6e,
+    0xf0, 0xff, 0x39, 0xf0, 0x7f, 0x1f, 0xf8, 0xbf, 0x0f, 0xf0, 0xdf, 0x07,
+    0xf0, 0x9f, 0x03, 0xf8, 0xcf, 0x01, 0x00, 0xdc, 0x00, 0x00, 0x1e, 0x00,
+    0x00, 0x0f, 0x00, 0x80, 0x1f, 0x00, 0xc0, 0x0f, 0x00, 0xe0, 0x07, 0x00,
+    0xf0, 0x03, 0x00, 0xf8, 0x01, 0x00, 0xfc, 0x00, 0x00, 0x7e, 0x00, 0x00,
+    0x3f, 0x00, 0x80, 0x1f, 0x00, 0xc0, 0x0f, 0x00, 0xe0, 0x07, 0x00, 0xf0,
+    0x03, 0x00, 0xf0, 0x01, 0x00, 0xe0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x30,
+    0xfc, 0xff, 0xff, 0xfd, 0xff, 0xcf, 0xfe, 0xff, 0xe7, 0xfc, 0xff, 0xf1,
+    0xfd, 0x3f, 0xf8, 0xfe, 0x1f, 0xfc, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x3f,
+    0x00, 0x80, 0x1f, 0x00, 0xc0, 0x0f, 0x00, 0xe0, 0x07, 0x00, 0xf0, 0x03,
+    0x00, 0xf8, 0x01, 0x00, 0xfc, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x3f, 0x00,
+    0x80, 0x1f, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xfb, 0x3f, 0x80, 0xfd, 0x1f,
+    0x00, 0xff, 0x1f, 0x80, 0xff, 0x0f, 0xc0, 0xff, 0x07, 0xc0, 0xff, 0x0d,
+    0x00, 0x00, 0x0f, 0x00, 0x80, 0x07, 0x00, 0xc0, 0x0f, 0x00, 0xe0, 0x07,
+    0x00, 0xf0, 0x03, 0x00, 0xf8, 0x01, 0x00, 0xfc, 0x00, 0x00, 0x7e, 0x00,
+    0x00, 0x3f, 0x00, 0x80, 0x1f, 0x00, 0xc0, 0x0f, 0x00, 0xe0, 0x07, 0x00,
+    0xf0, 0x03, 0x00, 0xf8, 0xc1, 0xff, 0xfb, 0xf8, 0xff, 0x73, 0xfc, 0xff,
+    0x39, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xf3, 0xff, 0xff, 0x01, 0xfc, 0xff,
+    0xff, 0xfd, 0xff, 0xcf, 0xfe, 0xff, 0xe7, 0xfc, 0xff, 0xf1, 0xfd, 0x3f,
+    0xf8, 0xfe, 0x1f, 0xfc, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x3f, 0x00, 0x80,
+    0x1f, 0x00, 0xc0, 0x0f, 0x00, 0xe0, 0x07, 0x00, 0xf0, 0x03, 0x00, 0xf8,
+    0x01, 0x00, 0xfc, 0x00, 0x00, 0x78, 0x00, 0x00, 0x3b, 0x00, 0x80, 0x1d,
+    0x00, 0xc0, 0x09, 0x00, 0xe0, 0xe3, 0x3f, 0xf0, 0xf1, 0x1f, 0xf8, 0xff,
+    0x1f, 0xfc, 0xff, 0x3f, 0xfe, 0xff, 0x1f, 0x1f, 0xff, 0x9f, 0x13, 0x00,
+    0xff, 0x09, 0x80, 0x7f, 0x07, 0xc0, 0xcf, 0x03, 0xe0, 0xe7, 0x01, 0xf0,
+    0xff, 0x00, 0xf8, 0x7f, 0x00, 0xfc, 0x3f, 0x00, 0xfe, 0x1f, 0x00, 0xff,
+    0x0f, 0x80, 0xff, 0x07, 0xc0, 0xff, 0x03, 0xe0, 0xff, 0x01, 0xf0, 0xff,
+    0x00, 0xf8, 0xbf, 0xff, 0xfb, 0xe7, 0xff, 0xf3, 0xf3, 0xff, 0xf9, 0xfe,
+    0xff, 0x9b, 0xff, 0xff, 0xc3, 0xff, 0xff, 0x01, 0xff, 0xff, 0x1f, 0xfe,
+    0xff, 0x37, 0xff, 0xff, 0x1b, 0xff, 0x7f, 0x0e, 0xfe, 0xdf, 0x07, 0xff,
+    0xef, 0x03, 0x00, 0xf8, 0x01, 0x00, 0xfc, 0x00, 0x00, 0x7e, 0x00, 0x00,
+    0x3f, 0x00, 0x80, 0x1f, 0x00, 0xc0, 0x0f, 0x00, 0xe0, 0x07, 0x00, 0xf0,
+    0x03, 0x00, 0xf8, 0x01, 0x00, 0x3c, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x37,
+    0x00, 0x80, 0x1c, 0x00, 0x80, 0x0f, 0x00, 0xc0, 0x07, 0x00, 0xf0, 0x03,
+    0x00, 0xf8, 0x01, 0x00, 0xfc, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x39, 0x00,
+    0x80, 0x1c, 0x00, 0xc0, 0x0d, 0x00, 0xe0, 0x01, 0x00, 0xf0, 0x00, 0x00,
+    0xf8, 0x01, 0x00, 0xfc, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x3f, 0x00, 0x80,
+    0x1f, 0x00, 0xc0, 0x0f, 0x00, 0xe0, 0x07, 0x00, 0xf0, 0x03, 0x00, 0xf8,
+    0x01, 0x00, 0xfc, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x1c,
+    0x00, 0x00, 0x0c, 0x00, 0x00, 0x06, 0xfc, 0xff, 0x9f, 0xfd, 0xff, 0xf7,
+    0xfe, 0xff, 0xfb, 0xfc, 0x7f, 0xfe, 0xfd, 0xdf, 0xff, 0xfe, 0xef, 0xff,
+    0x00, 0xf8, 0x7f, 0x00, 0xfc, 0x3f, 0x00, 0xfe, 0x1f, 0x00, 0xff, 0x0f,
+    0x80, 0xff, 0x07, 0xc0, 0xff, 0x03, 0xe0, 0xff, 0x01, 0xf0, 0xff, 0x00,
+    0xf8, 0x79, 0x00, 0x3c, 0x3b, 0x00, 0xee, 0x1d, 0x00, 0xf7, 0xc9, 0x9f,
+    0xfc, 0xfb, 0xbf, 0xff, 0xfd, 0xdf, 0xff, 0xfe, 0xef, 0x9f, 0xfc, 0xc9,
+    0x4f, 0xfe, 0xe4, 0x3b, 0x00, 0x6e, 0x1e, 0x00, 0x0f, 0x0f, 0x80, 0xe7,
+    0x07, 0xc0, 0xff, 0x03, 0xe0, 0xff, 0x01, 0xf0, 0xff, 0x00, 0xf8, 0x7f,
+    0x00, 0xfc, 0x3f, 0x00, 0xfe, 0x1f, 0x00, 0xff, 0x0f, 0x80, 0xff, 0x07,
+    0xc0, 0xff, 0x03, 0xe0, 0xff, 0x01, 0xf0, 0xff, 0x00, 0xf8, 0xbf, 0xff,
+    0xfb, 0xe7, 0xff, 0xf3, 0xf3, 0xff, 0xf9, 0xfe, 0xff, 0x9b, 0xff, 0xff,
+    0xc3, 0xff, 0xff, 0x01, 0xfc, 0xff, 0x9f, 0xfd, 0xff, 0xf7, 0xfe, 0xff,
+    0xfb, 0xfc, 0x7f, 0xfe, 0xfd, 0xdf, 0xff, 0xfe, 0xef, 0xff, 0x00, 0xf8,
+    0x7f, 0x00, 0xfc, 0x3f, 0x00, 0xfe, 0x1f, 0x00, 0xff, 0x0f, 0x80, 0xff,
+    0x07, 0xc0, 0xff, 0x03, 0xe0, 0xff, 0x01, 0xf0, 0xff, 0x00, 0xf8, 0x7f,
+    0x00, 0x3c, 0x3f, 0x00, 0xee, 0x1f, 0x00, 0xf7, 0x0f, 0x80, 0x9c, 0xff,
+    0x8f, 0xcf, 0xff, 0xc7, 0xc7, 0xff, 0xff, 0x83, 0xff, 0xff, 0xc1, 0xff,
+    0xff, 0xc0, 0x7f, 0x7c, 0x00, 0x00, 0x39, 0x00, 0x80, 0x1c, 0x00, 0xc0,
+    0x0d, 0x00, 0xe0, 0x01, 0x00, 0xf0, 0x00, 0x00, 0xf8, 0x01, 0x00, 0xfc,
+    0x00, 0x00, 0x7e, 0x00, 0x00, 0x3f, 0x00, 0x80, 0x1f, 0x00, 0xc0, 0x0f,
+    0x00, 0xe0, 0x07, 0x00, 0xf0, 0x03, 0x00, 0xf8, 0xc1, 0xff, 0xfb, 0xf8,
+    0xff, 0x73, 0xfc, 0xff, 0x39, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xf3, 0xff,
+    0xff, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00
+};
+
+const lcd_font_t lcd_font48 = {
+    48, 48, ' ', 27, 0,
+    font48_map, font48_glyphs, font48_bits, 0
+};
+
+//16 pixels high, proportional, 95 glyphs
+static const u8 font16p_map[95] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b,
+    0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+    0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20, 0x21, 0x22, 0x23,
+    0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b,
+    0x3c, 0x3d, 0x3e, 0x3f, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50, 0x51, 0x52, 0x53,
+    0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e
+};
+
+static const lcd_glyph_t font16p_glyphs[95] = {
+    //offset  x   y   w   h  advance
+    {     0,  0,  0,  0,  0,  4 }, /*" "*/
+    {     0,  0,  3,  2, 11,  3 }, /*"!"*/
+    {     3,  0,  1,  5,  6,  6 }, /*"""*/
+    {     7,  0,  3,  7, 11,  8 }, /*"#"*/
+    {    17,  0,  2,  5, 14,  6 }, /*"$"*/
+    {    26,  0,  1,  7, 14,  8 }, /*"%"*/
+    {    39,  0,  3,  8, 11,  9 }, /*"&"*/
+    {    50,  0,  1,  2,  6,  3 }, /*"'"*/
+    {    52,  0,  1,  4, 14,  5 }, /*"("*/
+    {    59,  0,  1,  4, 14,  5 }, /*")"*/
+    {    66,  0,  4,  7,  8,  8 }, /*"*"*/
+    {    73,  0,  4,  7,  9,  8 }, /*"+"*/
+    {    81,  0, 12,  3,  4,  4 }, /*","*/
+    {    83,  0,  8,  7,  1,  8 }, /*"-"*/
+    {    84,  0, 12,  2,  2,  3 }, /*"."*/
+    {    85,  0,  2,  7, 13,  8 }, /*"/"*/
+    {    97,  0,  1,  7, 14,  8 }, /*"0"*/
+    {   110,  0,  1,  7, 14,  8 }, /*"1"*/
+    {   123,  0,  1,  7, 14,  8 }, /*"2"*/
+    {   136,  0,  1,  7, 14,  8 }, /*"3"*/
+    {   149,  0,  1,  7, 14,  8 }, /*"4"*/
+    {   162,  0,  1,  7, 14,  8 }, /*"5"*/
+    {   175,  0,  1,  7, 14,  8 }, /*"6"*/
+    {   188,  0,  1,  7, 14,  8 }, /*"7"*/
+    {   201,  0,  1,  7, 14,  8 }, /*"8"*/
+    {   214,  0,  1,  7, 14,  8 }, /*"9"*/
+    {   227,  0,  6,  2,  8,  3 }, /*":"*/
+    {   229,  0,  7,  2,  9,  3 }, /*";"*/
+    {   232,  0,  3,  6, 11,  7 }, /*"<"*/
+    {   241,  0,  6,  7,  5,  8 }, /*"="*/
+    {   246,  0,  3,  6, 11,  7 }, /*">"*/
+    {   255,  0,  1,  7, 14,  8 }, /*"?"*/
+    {   268,  0,  3,  7, 11,  8 }, /*"@"*/
+    {   278,  0,  1,  7, 14,  8 }, /*"A"*/
+    {   291,  0,  1,  7, 14,  8 }, /*"B"*/
+    {   304,  0,  1,  7, 14,  8 }, /*"C"*/
+    {   317,  0,  1,  7, 14,  8 }, /*"D"*/
+    {   330,  0,  1,  7, 14,  8 }, /*"E"*/
+    {   343,  0,  1,  7, 14,  8 }, /*"F"*/
+    {   356,  0,  1,  7, 14,  8 }, /*"G"*/
+    {   369,  0,  1,  7, 14,  8 }, /*"H"*/
+    {   382,  0,  1,  7, 14,  8 }, /*"I"*/
+    {   395,  0,  1,  7, 14,  8 }, /*"J"*/
+    {   408,  0,  1,  6, 14,  7 }, /*"K"*/
+    {   419,  0,  1,  7, 14,  8 }, /*"L"*/
+    {   432,  0,  1,  7, 14,  8 }, /*"M"*/
+    {   445,  0,  1,  7, 14,  8 }, /*"N"*/
+    {   458,  0,  1,  7, 14,  8 }, /*"O"*/
+    {   471,  0,  1,  7, 14,  8 }, /*"P"*/
+    {   484,  0,  1,  7, 14,  8 }, /*"Q"*/
+    {   497,  0,  1,  7, 14,  8 }, /*"R"*/
+    {   510,  0,  1,  7, 14,  8 }, /*"S"*/
+    {   523,  0,  1,  7, 14,  8 }, /*"T"*/
+    {   536,  0,  1,  7, 14,  8 }, /*"U"*/
+    {   549,  0,  2,  7, 13,  8 }, /*"V"*/
+    {   561,  0,  1,  7, 14,  8 }, /*"W"*/
+    {   574,  0,  1,  7, 14,  8 }, /*"X"*/
+    {   587,  0,  1,  7, 14,  8 }, /*"Y"*/
+    {   600,  0,  3,  7, 11,  8 }, /*"Z"*/
+    {   610,  0,  1,  4, 14,  5 }, /*"["*/
+    {   617,  0,  2,  6, 14,  7 }, /*"\"*/
+    {   628,  0,  1,  4, 14,  5 }, /*"]"*/
+    {   635,  0,  1,  4,  7,  5 }, /*"^"*/
+    {   639,  0, 15,  8,  1,  9 }, /*"_"*/
+    {   640,  0,  1,  3,  2,  4 }, /*"`"*/
+    {   641,  0,  1,  7, 14,  8 }, /*"a"*/
+    {   654,  0,  1,  7, 14,  8 }, /*"b"*/
+    {   667,  0,  1,  7, 14,  8 }, /*"c"*/
+    {   680,  0,  1,  7, 14,  8 }, /*"d"*/
+    {   693,  0,  1,  7, 14,  8 }, /*"e"*/
+    {   706,  0,  1,  7, 14,  8 }, /*"f"*/
+    {   719,  0,  1,  7, 14,  8 }, /*"g"*/
+    {   732,  0,  1,  7, 14,  8 }, /*"h"*/
+    {   745,  0,  1,  7, 14,  8 }, /*"i"*/
+    {   758,  0,  1,  7, 14,  8 }, /*"j"*/
+    {   771,  0,  1,  6, 14,  7 }, /*"k"*/
+    {   782,  0,  1,  7, 14,  8 }, /*"l"*/
+    {   795,  0,  1,  7, 14,  8 }, /*"m"*/
+    {   808,  0,  1,  7, 14,  8 }, /*"n"*/
+    {   821,  0,  1,  7, 14,  8 }, /*"o"*/
+    {   834,  0,  1,  7, 14,  8 }, /*"p"*/
+    {   847,  0,  1,  7, 14,  8 }, /*"q"*/
+    {   860,  0,  1,  7, 14,  8 }, /*"r"*/
+    {   873,  0,  1,  7, 14,  8 }, /*"s"*/
+    {   886,  0,  1,  7, 14,  8 }, /*"t"*/
+    {   899,  0,  1,  7, 14,  8 }, /*"u"*/
+    {   912,  0,  2,  7, 13,  8 }, /*"v"*/
+    {   924,  0,  1,  7, 14,  8 }, /*"w"*/
+    {   937,  0,  1,  7, 14,  8 }, /*"x"*/
+    {   950,  0,  1,  7, 14,  8 }, /*"y"*/
+    {   963,  0,  7,  6,  7,  7 }, /*"z"*/
+    {   969,  0,  1,  4, 14,  5 }, /*"{"*/
+    {   976,  0,  0,  1, 16,  2 }, /*"|"*/
+    {   978,  0,  1,  4, 14,  5 }, /*"}"*/
+    {   985,  0,  0,  7,  3,  8 }, /*"~"*/
+};
+
+static const u8 font16p_bits[991] = {
+    0x55, 0x15, 0x3c, 0x69, 0xef, 0xbd, 0x25, 0x24, 0x12, 0xe9, 0x2f, 0x91,
+    0x48, 0xfe, 0x12, 0x89, 0x04, 0xc4, 0xd5, 0x5a, 0x0c, 0xa3, 0xb4, 0x56,
+    0x47, 0x08, 0xa3, 0x31, 0x18, 0x0c, 0x06, 0x7b, 0x7f, 0x83, 0xc1, 0x60,
+    0x30, 0x16, 0x03, 0x0c, 0x12, 0x12, 0x12, 0x0a, 0x76, 0x25, 0x29, 0x11,
+    0x91, 0x6e, 0xfd, 0x0b, 0x48, 0x22, 0x11, 0x11, 0x11, 0x22, 0x84, 0x21,
+    0x44, 0x88, 0x88, 0x88, 0x44, 0x12, 0x08, 0xc4, 0x9a, 0xc3, 0x59, 0x23,
+    0x10, 0x08, 0x04, 0x02, 0xf1, 0x47, 0x20, 0x10, 0x08, 0x36, 0x07, 0x7f,
+    0x0f, 0x40, 0x10, 0x08, 0x02, 0x41, 0x20, 0x08, 0x04, 0x81, 0x20, 0x10,
+    0x00, 0xbf, 0xef, 0x78, 0x3c, 0x1e, 0x0b, 0xc3, 0xe3, 0xf1, 0x78, 0xdc,
+    0xff, 0x03, 0x0f, 0x0f, 0x06, 0x83, 0xc1, 0x20, 0x20, 0x18, 0x0c, 0x06,
+    0xe3, 0xfb, 0x03, 0x3f, 0x2f, 0x18, 0x0c, 0x06, 0x7b, 0x7f, 0x83, 0xc1,
+    0x60, 0xd0, 0xfb, 0x03, 0x3f, 0x3f, 0x18, 0x0c, 0x06, 0x73, 0x7d, 0x60,
+    0x30, 0x18, 0xec, 0xfd, 0x01, 0xc1, 0xf1, 0x78, 0x3c, 0x1e, 0xf7, 0xbd,
+    0x60, 0x30, 0x18, 0x0c, 0x06, 0x02, 0xff, 0xdf, 0x60, 0x30, 0x18, 0xfc,
+    0xbc, 0x60, 0x30, 0x18, 0xec, 0xff, 0x03, 0xff, 0xdf, 0x60, 0x30, 0x18,
+    0xfc, 0xfa, 0xe3, 0xf1, 0x78, 0xdc, 0xff, 0x03, 0x7f, 0x1f, 0x10, 0x0c,
+    0x06, 0x03, 0x41, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x02, 0xbf, 0xef, 0x78,
+    0x3c, 0x1e, 0xfb, 0x38, 0xa3, 0xf1, 0x78, 0xdc, 0xf7, 0x01, 0xbf, 0xef,
+    0x78, 0x3c, 0x1e, 0x7f, 0x7d, 0x60, 0x30, 0x18, 0xec, 0xfd, 0x03, 0x0f,
+    0xf0, 0x02, 0xa0, 0x01, 0x20, 0x84, 0x10, 0x42, 0x20, 0x10, 0x08, 0x04,
+    0x02, 0x7f, 0x00, 0x00, 0xf0, 0x07, 0x81, 0x40, 0x20, 0x10, 0x08, 0x21,
+    0x84, 0x10, 0x00, 0xbf, 0xee, 0x78, 0x1c, 0x06, 0xf3, 0x69, 0x0c, 0x06,
+    0x83, 0x80, 0x60, 0x00, 0x1c, 0x91, 0xb6, 0x5a, 0xad, 0x56, 0x5b, 0x42,
+    0x11, 0x07, 0xbe, 0xee, 0x78, 0x3c, 0x1e, 0xff, 0xfb, 0xe3, 0xf1, 0x78,
+    0x3c, 0x0e, 0x02, 0xbf, 0xfe, 0x78, 0x3c, 0x1e, 0xff, 0x3e, 0xa3, 0xf1,
+    0x78, 0xdc, 0xff, 0x01, 0xfe, 0xde, 0x60, 0x30, 0x18, 0x04, 0x06, 0x83,
+    0xc1, 0x60, 0xd0, 0xf3, 0x03, 0xbf, 0xfe, 0x78, 0x3c, 0x1e, 0x87, 0x87,
+    0xe3, 0xf1, 0x78, 0xdc, 0xff, 0x01, 0xff, 0xde, 0x60, 0x30, 0x18, 0xf4,
+    0x3c, 0x83, 0xc1, 0x60, 0xd0, 0xfb, 0x03, 0xff, 0xde, 0x60, 0x30, 0x08,
+    0x38, 0x3a, 0x83, 0xc1, 0x60, 0x30, 0x08, 0x00, 0xbe, 0xfe, 0x60, 0x30,
+    0x18, 0xc4, 0x75, 0xc3, 0xf1, 0x78, 0xfc, 0xf5, 0x01, 0xc1, 0xf1, 0x78,
+    0x3c, 0x1e, 0x7f, 0x7b, 0xe3, 0xf1, 0x78, 0x3c, 0x0e, 0x02, 0x7f, 0x1f,
+    0x02, 0x83, 0xc1, 0x40, 0x10, 0x18, 0x0c, 0x06, 0x61, 0xfb, 0x03, 0x78,
+    0x38, 0x10, 0x0c, 0x06, 0x83, 0x80, 0x60, 0x30, 0x18, 0xfc, 0xf5, 0x01,
+    0xe1, 0x3c, 0xcf, 0xf3, 0xf4, 0x74, 0xf3, 0x3c, 0xcf, 0x73, 0x08, 0x81,
+    0xc1, 0x60, 0x30, 0x18, 0x04, 0x06, 0x83, 0xc1, 0x60, 0xd0, 0xfb, 0x03,
+    0xff, 0xef, 0x7a, 0xbd, 0x5e, 0x0f, 0x45, 0xe3, 0xf1, 0x78, 0x3c, 0x0e,
+    0x02, 0xff, 0xef, 0x78, 0x3c, 0x1e, 0x8b, 0x83, 0xe3, 0xf1, 0x78, 0x3c,
+    0x1e, 0x03, 0xbf, 0xef, 0x78, 0x3c, 0x1e, 0x0b, 0xc3, 0xe3, 0xf1, 0x78,
+    0xdc, 0xff, 0x03, 0xbf, 0xfe, 0x78, 0x3c, 0x1e, 0xff, 0x7a, 0x83, 0xc1,
+    0x60, 0x30, 0x08, 0x00, 0xff, 0xee, 0x78, 0x3c, 0x1e, 0x8f, 0x45, 0xe3,
+    0xf1, 0x7a, 0xdd, 0xfd, 0x03, 0xbf, 0xef, 0x78, 0x3c, 0x1e, 0xff, 0x3a,
+    0x9b, 0xdd, 0x6c, 0x3c, 0x0e, 0x02, 0xfe, 0xdf, 0x60, 0x30, 0x18, 0xf4,
+    0xbc, 0x60, 0x30, 0x18, 0xec, 0xfd, 0x01, 0x7f, 0x1f, 0x02, 0x83, 0xc1,
+    0x60, 0x20, 0x18, 0x0c, 0x06, 0x83, 0x41, 0x00, 0xc1, 0xf1, 0x78, 0x3c,
+    0x1e, 0x87, 0x85, 0xe3, 0xf1, 0x78, 0xfc, 0xf7, 0x01, 0xc1, 0xf1, 0x78,
+    0x3c, 0x0e, 0x93, 0xd9, 0x6c, 0x36, 0x1a, 0x0e, 0x03, 0xc1, 0xf1, 0x78,
+    0x3c, 0x1e, 0x07, 0x47, 0xeb, 0xf5, 0x7a, 0xdd, 0xfd, 0x03, 0xc1, 0xf1,
+    0x78, 0x3c, 0x1e, 0xfa, 0x38, 0xa2, 0xf1, 0x78, 0x3c, 0x0e, 0x02, 0xc1,
+    0xf1, 0x78, 0x3c, 0x1e, 0xf7, 0xbc, 0x60, 0x30, 0x18, 0xcc, 0xc5, 0x01,
+    0xfe, 0x10, 0x08, 0x02, 0x41, 0x10, 0x08, 0x42, 0xe1, 0x0f, 0x1f, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0xf1, 0x41, 0x20, 0x08, 0x04, 0x41, 0x20, 0x08,
+    0x04, 0x41, 0x20, 0x08, 0x8f, 0x88, 0x88, 0x88, 0x88, 0x88, 0xf8, 0xd6,
+    0xdd, 0xdd, 0x06, 0xff, 0x23, 0xbe, 0xee, 0x78, 0x3c, 0x1e, 0xff, 0xfb,
+    0xe3, 0xf1, 0x78, 0x3c, 0x0e, 0x02, 0xbf, 0xfe, 0x78, 0x3c, 0x1e, 0xff,
+    0x3e, 0xa3, 0xf1, 0x78, 0xdc, 0xff, 0x01, 0xfe, 0xde, 0x60, 0x30, 0x18,
+    0x04, 0x06, 0x83, 0xc1, 0x60, 0xd0, 0xf3, 0x03, 0xbf, 0xfe, 0x78, 0x3c,
+    0x1e, 0x87, 0x87, 0xe3, 0xf1, 0x78, 0xdc, 0xff, 0x01, 0xff, 0xde, 0x60,
+    0x30, 0x18, 0xf4, 0x3c, 0x83, 0xc1, 0x60, 0xd0, 0xfb, 0x03, 0xff, 0xde,
+    0x60, 0x30, 0x08, 0x38, 0x3a, 0x83, 0xc1, 0x60, 0x30, 0x08, 0x00, 0xbe,
+    0xfe, 0x60, 0x30, 0x18, 0xc4, 0x75, 0xc3, 0xf1, 0x78, 0xfc, 0xf5, 0x01,
+    0xc1, 0xf1, 0x78, 0x3c, 0x1e, 0x7f, 0x7b, 0xe3, 0xf1, 0x78, 0x3c, 0x0e,
+    0x02, 0x7f, 0x1f, 0x02, 0x83, 0xc1, 0x40, 0x10, 0x18, 0x0c, 0x06, 0x61,
+    0xfb, 0x03, 0x78, 0x38, 0x10, 0x0c, 0x06, 0x83, 0x80, 0x60, 0x30, 0x18,
+    0xfc, 0xf5, 0x01, 0xe1, 0x3c, 0xcf, 0xf3, 0xf4, 0x74, 0xf3, 0x3c, 0xcf,
+    0x73, 0x08, 0x81, 0xc1, 0x60, 0x30, 0x18, 0x04, 0x06, 0x83, 0xc1, 0x60,
+    0xd0, 0xfb, 0x03, 0xff, 0xef, 0x7a, 0xbd, 0x5e, 0x0f, 0x45, 0xe3, 0xf1,
+    0x78, 0x3c, 0x0e, 0x02, 0xff, 0xef, 0x78, 0x3c, 0x1e, 0x8b, 0x83, 0xe3,
+    0xf1, 0x78, 0x3c, 0x1e, 0x03, 0xbf, 0xef, 0x78, 0x3c, 0x1e, 0x0b, 0xc3,
+    0xe3, 0xf1, 0x78, 0xdc, 0xff, 0x03, 0xbf, 0xfe, 0x78, 0x3c, 0x1e, 0xff,
+    0x7a, 0x83, 0xc1, 0x60, 0x30, 0x08, 0x00, 0xff, 0xee, 0x78, 0x3c, 0x1e,
+    0x8f, 0x45, 0xe3, 0xf1, 0x7a, 0xdd, 0xfd, 0x03, 0xbf, 0xef, 0x78, 0x3c,
+    0x1e, 0xff, 0x3a, 0x9b, 0xdd, 0x6c, 0x3c, 0x0e, 0x02, 0xfe, 0xdf, 0x60,
+    0x30, 0x18, 0xf4, 0xbc, 0x60, 0x30, 0x18, 0xec, 0xfd, 0x01, 0x7f, 0x1f,
+    0x02, 0x83, 0xc1, 0x60, 0x20, 0x18, 0x0c, 0x06, 0x83, 0x41, 0x00, 0xc1,
+    0xf1, 0x78, 0x3c, 0x1e, 0x87, 0x85, 0xe3, 0xf1, 0x78, 0xfc, 0xf7, 0x01,
+    0xc1, 0xf1, 0x78, 0x3c, 0x0e, 0x93, 0xd9, 0x6c, 0x36, 0x1a, 0x0e, 0x03,
+    0xc1, 0xf1, 0x78, 0x3c, 0x1e, 0x07, 0x47, 0xeb, 0xf5, 0x7a, 0xdd, 0xfd,
+    0x03, 0xc1, 0xf1, 0x78, 0x3c, 0x1e, 0xfa, 0x38, 0xa2, 0xf1, 0x78, 0x3c,
+    0x0e, 0x02, 0xc1, 0xf1, 0x78, 0x3c, 0x1e, 0xf7, 0xbc, 0x60, 0x30, 0x18,
+    0xcc, 0xc5, 0x01, 0x7f, 0x84, 0x10, 0x84, 0xf8, 0x03, 0x2c, 0x22, 0x22,
+    0x21, 0x22, 0x22, 0xc2, 0xff, 0xff, 0x43, 0x44, 0x44, 0x48, 0x44, 0x44,
+    0x34, 0x86, 0x4c, 0x18, 0x00, 0x00, 0x00
+};
+
+static const lcd_kern_t font16p_kern[] = {
+    { 'L', 'T', -2 },
+    { 'L', 'V', -2 },
+    { 'L', 'Y', -2 },
+    { 'L', 'y', -2 },
+};
+
+const lcd_font_t lcd_font16p = {
+    16 | LCD_PROP, 16, ' ', 95, 4,
+    font16p_map, font16p_glyphs, font16p_bits, font16p_kern
+};
+
+const lcd_font_t *const lcd_fonts[] = {
+    &lcd_font12, &lcd_font16, &lcd_font32, &lcd_font48, &lcd_font16p, 0
+};
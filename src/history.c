@@ -0,0 +1,53 @@
+/*****************************************************************************
+ * This code keeps a ring of the last HISTORY_DAYS daily records. The ring   *
+ * lives in ".noinit" RAM so a reset does not lose it; a magic word tells a  *
+ * ring left by the previous run apart from the random contents of RAM after *
+ * power-up.                                                                 *
+ *****************************************************************************/
+#include "stm32f0xx.h"
+#include "history.h"
+
+#define NO_INIT_GCC   __attribute__ ((section (".noinit")))
+#define HISTORY_MAGIC 0x48495354    //"HIST"
+
+static struct {
+    uint32_t     magic;
+    int          head;              //Next slot to write
+    int          count;
+    day_record_t days[HISTORY_DAYS];
+} ring NO_INIT_GCC;
+
+static void history_check(void) {
+    if(ring.magic != HISTORY_MAGIC || ring.head < 0 || ring.head >= HISTORY_DAYS
+       || ring.count < 0 || ring.count > HISTORY_DAYS) {
+        ring.magic = HISTORY_MAGIC;
+        ring.head  = 0;
+        ring.count = 0;
+    }
+}
+
+void history_add(const day_record_t *rec) {
+    history_check();
+    ring.days[ring.head] = *rec;
+    ring.head = (ring.head + 1) % HISTORY_DAYS;
+    if(ring.count < HISTORY_DAYS)
+        ring.count++;
+}
+
+//============================================================================
+// HISTORY_GET
+//  * Copies the record from days_ago days back (1 is the day that ended
+//    most recently). Returns 0, or -1 if that day is not in the history.
+//============================================================================
+int history_get(int days_ago, day_record_t *rec) {
+    history_check();
+    if(days_ago < 1 || days_ago > ring.count)
+        return -1;
+    *rec = ring.days[(ring.head - days_ago + HISTORY_DAYS) % HISTORY_DAYS];
+    return 0;
+}
+
+int history_count(void) {
+    history_check();
+    return ring.count;
+}
@@ -6,74 +6,20 @@
 #include "stm32f0xx.h"
 #include <stdint.h>
 #include "lcd.h"
+#include "lcd_spi.h"
 
 lcd_dev_t lcddev;
 
-#define SPI SPI1
-
-#define CS_NUM  8
-#define CS_BIT  (1<<CS_NUM)
-#define CS_HIGH do { GPIOB->BSRR = GPIO_BSRR_BS_8; } while(0)
-#define CS_LOW do { GPIOB->BSRR = GPIO_BSRR_BR_8; } while(0)
-#define RESET_NUM 11
-#define RESET_BIT (1<<RESET_NUM)
-#define RESET_HIGH do { GPIOB->BSRR = GPIO_BSRR_BS_11; } while(0)
-#define RESET_LOW  do { GPIOB->BSRR = GPIO_BSRR_BR_11; } while(0)
-#define DC_NUM 14
-#define DC_BIT (1<<DC_NUM)
-#define DC_HIGH do { GPIOB->BSRR = GPIO_BSRR_BS_14; } while(0)
-#define DC_LOW  do { GPIOB->BSRR = GPIO_BSRR_BR_14; } while(0)
-
-// Set the CS pin low if val is non-zero.
-// Note that when CS is being set high again, wait on SPI to not be busy.
-static void tft_select(int val)
-{
-    if (val == 0) {
-        while(SPI1->SR & SPI_SR_BSY)
-            ;
-        CS_HIGH;
-    } else {
-        while((GPIOB->ODR & (CS_BIT)) == 0) {
-            ; // If CS is already low, this is an error.  Loop forever.
-            // This has happened because something called a drawing subroutine
-            // while one was already in process.  For instance, the main()
-            // subroutine could call a long-running LCD_DrawABC function,
-            // and an ISR interrupts it and calls another LCD_DrawXYZ function.
-            // This is a common mistake made by students.
-            // This is what catches the problem early.
-        }
-        CS_LOW;
-    }
-}
-
-// If val is non-zero, set nRESET low to reset the display.
-static void tft_reset(int val)
-{
-    if (val) {
-        RESET_LOW;
-    } else {
-        RESET_HIGH;
-    }
-}
-
-// If
-static void tft_reg_select(int val)
-{
-    if (val == 1) { // select registers
-        DC_LOW; // clear
-    } else { // select data
-        DC_HIGH; // set
-    }
-}
-
 //============================================================================
 // Wait for n nanoseconds. (Maximum: 4.294 seconds)
 //============================================================================
+#ifndef nano_wait
 static inline void nano_wait(unsigned int n) {
     asm(    "        mov r0,%0\n"
             "repeat: sub r0,#83\n"
             "        bgt repeat\n" : : "r"(n) : "r0", "cc");
 }
+#endif
 
 void LCD_Reset(void)
 {
@@ -83,110 +29,6 @@ void LCD_Reset(void)
     nano_wait(50000000);  // Wait
 }
 
-// If you want to try the slower version of SPI, #define SLOW_SPI
-
-#if defined(SLOW_SPI)
-
-// What GPIO port and SPI channel are we using here?
-#define CSPORT GPIOB
-#define LCD_CS    10 /* also known as NSS */
-#define RSPORT GPIOA
-#define LCD_RS    3
-#define RESETPORT GPIOB
-#define LCD_RESET 11
-
-#define LCD_CS_SET  do { while((SPI->SR & SPI_SR_BSY) != 0); CSPORT->BSRR=1<<LCD_CS; } while(0)
-#define LCD_RS_SET  RSPORT->BSRR=1<<LCD_RS
-#define LCD_RESET_SET RESETPORT->BSRR=1<<LCD_RESET
-
-#define LCD_CS_CLR  CSPORT->BRR=1<<LCD_CS
-#define LCD_RS_CLR  RSPORT->BRR=1<<LCD_RS
-#define LCD_RESET_CLR RESETPORT->BRR=1<<LCD_RESET
-
-// Write a byte to SPI.
-void SPI_WriteByte(uint8_t Data)
-{
-    while((SPI->SR & SPI_SR_TXE) == 0)
-        ;
-    *((uint8_t*)&SPI->DR) = Data;
-}
-
-// Write to an LCD "register"
-void LCD_WR_REG(uint8_t data)
-{
-    lcddev.reg_select(1);
-    SPI_WriteByte(data);
-}
-
-// Write 8-bit data to the LCD
-void LCD_WR_DATA(uint8_t data)
-{
-    lcddev.reg_select(0);
-    SPI_WriteByte(data);
-}
-
-// Prepare to write 16-bit data to the LCD
-void LCD_WriteData16_Prepare()
-{
-    lcddev.reg_select(0);
-}
-
-// Write 16-bit data
-void LCD_WriteData16(u16 Data)
-{
-    SPI_WriteByte(Data>>8);
-    SPI_WriteByte(Data);
-}
-
-// Finish writing 16-bit data
-void LCD_WriteData16_End()
-{
-}
-
-#else /* not SLOW_SPI */
-
-// Write to an LCD "register"
-void LCD_WR_REG(uint8_t data)
-{
-    while((SPI->SR & SPI_SR_BSY) != 0)
-        ;
-    // Don't clear RS until the previous operation is done.
-    lcddev.reg_select(1);
-    *((uint8_t*)&SPI->DR) = data;
-}
-
-// Write 8-bit data to the LCD
-void LCD_WR_DATA(uint8_t data)
-{
-    while((SPI->SR & SPI_SR_BSY) != 0)
-        ;
-    // Don't set RS until the previous operation is done.
-    lcddev.reg_select(0);
-    *((uint8_t*)&SPI->DR) = data;
-}
-
-// Prepare to write 16-bit data to the LCD
-void LCD_WriteData16_Prepare()
-{
-    lcddev.reg_select(0);
-    SPI->CR2 |= SPI_CR2_DS;
-}
-
-// Write 16-bit data
-void LCD_WriteData16(u16 data)
-{
-    while((SPI->SR & SPI_SR_TXE) == 0)
-        ;
-    SPI->DR = data;
-}
-
-// Finish writing 16-bit data
-void LCD_WriteData16_End()
-{
-    SPI->CR2 &= ~SPI_CR2_DS; // bad value forces it back to 8-bit mode
-}
-#endif /* not SLOW_SPI */
-
 // Select an LCD "register" and write 8-bit data to it.
 void LCD_WriteReg(uint8_t LCD_Reg, uint16_t LCD_RegValue)
 {
@@ -203,6 +45,8 @@ void LCD_WriteRAM_Prepare(void)
 // Configure the lcddev fields for the display orientation.
 void LCD_direction(u8 direction)
 {
+    LCD_ForgetWindow();
+    lcddev.dir=direction;
     lcddev.setxcmd=0x2A;
     lcddev.setycmd=0x2B;
     lcddev.wramcmd=0x2C;
@@ -243,7 +87,7 @@ void LCD_Init(void (*reset)(int), void (*select)(int), void (*reg_select)(int))
         lcddev.select = select;
     if (reg_select)
         lcddev.reg_select = reg_select;
-    lcddev.select(1);
+    LCD_Select();
     LCD_Reset();
     // Initialization sequence for 2.2inch ILI9341
     LCD_WR_REG(0xCF);
@@ -341,41 +185,107 @@ void LCD_Init(void (*reset)(int), void (*select)(int), void (*reg_select)(int))
     LCD_WR_REG(0x29);     // Display on
 
     LCD_direction(USE_HORIZONTAL);
-    lcddev.select(0);
+    LCD_Release();
 }
 
-__attribute((weak)) void init_lcd_spi(void)
+//===========================================================================
+// The address window the panel has, so LCD_SetWindow() can skip a column
+// or page command that would not change it. Anything that sets the panel's
+// window some other way, or resets the panel, must forget it.
+//===========================================================================
+static u16 win_x0, win_x1, win_y0, win_y1;
+static u8  win_valid;
+
+void LCD_ForgetWindow(void)
+{
+    win_valid = 0;
+}
+
+//===========================================================================
+// Select a subset of the display to work on, and issue the "Write RAM"
+// command to prepare to send pixel data to it. The Write RAM command is
+// always sent: it is what moves the panel back to the window's start.
+//===========================================================================
+void LCD_SetWindow(uint16_t xStart, uint16_t yStart, uint16_t xEnd, uint16_t yEnd)
 {
-    printf("init_lcd_spi() not defined.");
+    if (!win_valid || xStart != win_x0 || xEnd != win_x1) {
+        u16 x[2] = { xStart, xEnd };
+        LCD_QueueCmd(lcddev.setxcmd, x, 2);
+        win_x0 = xStart;
+        win_x1 = xEnd;
+    }
+    if (!win_valid || yStart != win_y0 || yEnd != win_y1) {
+        u16 y[2] = { yStart, yEnd };
+        LCD_QueueCmd(lcddev.setycmd, y, 2);
+        win_y0 = yStart;
+        win_y1 = yEnd;
+    }
+    win_valid = 1;
+    LCD_QueueCmd(lcddev.wramcmd, 0, 0);
+    LCD_SendCmds();
 }
 
+//===========================================================================
+// Set up SPI and initialize the panel. This is done once, at startup: the
+// reset and sleep-out waits alone take 270ms. Later calls only resume.
+//===========================================================================
+static u8 lcd_ready;
+static u8 lcd_asleep;
+
 void LCD_Setup() {
+    if (lcd_ready) {
+        LCD_Resume();
+        return;
+    }
+    LCD_DMA_Wait();         // Don't reconfigure SPI under a transfer
     init_lcd_spi();
+    LCD_DMA_Init();
     tft_select(0);
     tft_reset(0);
     tft_reg_select(0);
     LCD_Init(tft_reset, tft_select, tft_reg_select);
+    lcd_ready = 1;
+    lcd_asleep = 0;
 }
 
 //===========================================================================
-// Select a subset of the display to work on, and issue the "Write RAM"
-// command to prepare to send pixel data to it.
+// Put the panel's registers that drawing relies on back the way lcd.c
+// expects them: the orientation (MADCTL) and a known, full-screen window.
+// RAM and every other register are kept, so the picture stays.
 //===========================================================================
-void LCD_SetWindow(uint16_t xStart, uint16_t yStart, uint16_t xEnd, uint16_t yEnd)
+void LCD_Resume(void)
 {
-    LCD_WR_REG(lcddev.setxcmd);
-    LCD_WR_DATA(xStart>>8);
-    LCD_WR_DATA(0x00FF&xStart);
-    LCD_WR_DATA(xEnd>>8);
-    LCD_WR_DATA(0x00FF&xEnd);
-
-    LCD_WR_REG(lcddev.setycmd);
-    LCD_WR_DATA(yStart>>8);
-    LCD_WR_DATA(0x00FF&yStart);
-    LCD_WR_DATA(yEnd>>8);
-    LCD_WR_DATA(0x00FF&yEnd);
-
-    LCD_WriteRAM_Prepare();
+    LCD_Select();
+    LCD_direction(lcddev.dir);
+    LCD_SetWindow(0,0,lcddev.width-1,lcddev.height-1);
+    LCD_Release();
+}
+
+//===========================================================================
+// Power control. In sleep the panel stops scanning and its oscillator and
+// drivers are off, but RAM and registers are kept; waking takes 5ms here,
+// though the panel must then stay awake 120ms before it may sleep again.
+// Display off blanks the screen but keeps the panel running, for a quick
+// blank without the sleep timing.
+//===========================================================================
+void LCD_Sleep(int sleep)
+{
+    if (!sleep == !lcd_asleep)
+        return;
+    LCD_Select();
+    LCD_QueueCmd(sleep ? 0x10 : 0x11, 0, 0);  // Sleep In / Sleep Out
+    LCD_SendCmds();
+    LCD_Release();
+    lcd_asleep = sleep != 0;
+    nano_wait(5000000);     // No command for 5ms
+}
+
+void LCD_DisplayOn(int on)
+{
+    LCD_Select();
+    LCD_QueueCmd(on ? 0x29 : 0x28, 0, 0);     // Display On / Off
+    LCD_SendCmds();
+    LCD_Release();
 }
 
 //===========================================================================
@@ -383,19 +293,10 @@ void LCD_SetWindow(uint16_t xStart, uint16_t yStart, uint16_t xEnd, uint16_t yEn
 //===========================================================================
 void LCD_Clear(u16 Color)
 {
-    lcddev.select(1);
-    unsigned int i,m;
+    LCD_Select();
     LCD_SetWindow(0,0,lcddev.width-1,lcddev.height-1);
-    LCD_WriteData16_Prepare();
-    for(i=0;i<lcddev.height;i++)
-    {
-        for(m=0;m<lcddev.width;m++)
-        {
-            LCD_WriteData16(Color);
-        }
-    }
-    LCD_WriteData16_End();
-    lcddev.select(0);
+    LCD_FillPixels(Color, (uint32_t)lcddev.width * lcddev.height);
+    LCD_Release();
 }
 
 //===========================================================================
@@ -411,55 +312,89 @@ static void _LCD_DrawPoint(u16 x, u16 y, u16 c)
 
 void LCD_DrawPoint(u16 x, u16 y, u16 c)
 {
-    lcddev.select(1);
+    LCD_Select();
     _LCD_DrawPoint(x,y,c);
-    lcddev.select(0);
+    LCD_Release();
 }
 
+static void _LCD_Fill(u16 sx,u16 sy,u16 ex,u16 ey,u16 color);
+
 //===========================================================================
 // Draw a line of color c from (x1,y1) to (x2,y2).
+// Horizontal and vertical lines are a single window and fill. Other lines
+// are stepped with Bresenham's algorithm, but the pixels that fall in the
+// same row (mostly horizontal lines) or the same column (mostly vertical
+// lines) are collected and sent as one run, so a window is only set each
+// time the line steps sideways.
 //===========================================================================
+static void _LCD_HLine(int xa, int xb, int y, u16 c)
+{
+    if (xa > xb)
+        _LCD_Fill(xb,y,xa,y,c);
+    else
+        _LCD_Fill(xa,y,xb,y,c);
+}
+
+static void _LCD_VLine(int x, int ya, int yb, u16 c)
+{
+    if (ya > yb)
+        _LCD_Fill(x,yb,x,ya,c);
+    else
+        _LCD_Fill(x,ya,x,yb,c);
+}
+
 static void _LCD_DrawLine(u16 x1, u16 y1, u16 x2, u16 y2, u16 c)
 {
-    u16 t;
-    int xerr=0,yerr=0,delta_x,delta_y,distance;
-    int incx,incy,uRow,uCol;
-
-    delta_x=x2-x1;
-    delta_y=y2-y1;
-    uRow=x1;
-    uCol=y1;
-    if(delta_x>0)incx=1;
-    else if(delta_x==0)incx=0;
-    else {incx=-1;delta_x=-delta_x;}
-    if(delta_y>0)incy=1;
-    else if(delta_y==0)incy=0;
-    else{incy=-1;delta_y=-delta_y;}
-    if( delta_x>delta_y)distance=delta_x;
-    else distance=delta_y;
-    for(t=0;t<=distance+1;t++ )
-    {
-        _LCD_DrawPoint(uRow,uCol,c);
-        xerr+=delta_x ;
-        yerr+=delta_y ;
-        if(xerr>distance)
-        {
-            xerr-=distance;
-            uRow+=incx;
+    int dx = x2 > x1 ? x2 - x1 : x1 - x2;
+    int dy = y2 > y1 ? y2 - y1 : y1 - y2;
+    int sx = x2 > x1 ? 1 : -1;
+    int sy = y2 > y1 ? 1 : -1;
+    int x = x1, y = y1, start, err, i;
+
+    if (dy == 0) {
+        _LCD_HLine(x1,x2,y1,c);
+        return;
+    }
+    if (dx == 0) {
+        _LCD_VLine(x1,y1,y2,c);
+        return;
+    }
+    if (dx >= dy) {
+        err = 2*dy - dx;
+        start = x;
+        for(i=0; i<=dx; i++, x+=sx) {
+            if (err > 0 || i == dx) {   // Last pixel of this row
+                _LCD_HLine(start,x,y,c);
+                start = x + sx;
+            }
+            if (err > 0) {
+                y += sy;
+                err -= 2*dx;
+            }
+            err += 2*dy;
         }
-        if(yerr>distance)
-        {
-            yerr-=distance;
-            uCol+=incy;
+    } else {
+        err = 2*dx - dy;
+        start = y;
+        for(i=0; i<=dy; i++, y+=sy) {
+            if (err > 0 || i == dy) {   // Last pixel of this column
+                _LCD_VLine(x,start,y,c);
+                start = y + sy;
+            }
+            if (err > 0) {
+                x += sx;
+                err -= 2*dy;
+            }
+            err += 2*dx;
         }
     }
 }
 
 void LCD_DrawLine(u16 x1, u16 y1, u16 x2, u16 y2, u16 c)
 {
-    lcddev.select(1);
+    LCD_Select();
     _LCD_DrawLine(x1,y1,x2,y2,c);
-    lcddev.select(0);
+    LCD_Release();
 }
 
 //===========================================================================
@@ -467,12 +402,18 @@ void LCD_DrawLine(u16 x1, u16 y1, u16 x2, u16 y2, u16 c)
 //===========================================================================
 void LCD_DrawRectangle(u16 x1, u16 y1, u16 x2, u16 y2, u16 c)
 {
-    lcddev.select(1);
-    _LCD_DrawLine(x1,y1,x2,y1,c);
-    _LCD_DrawLine(x1,y1,x1,y2,c);
-    _LCD_DrawLine(x1,y2,x2,y2,c);
-    _LCD_DrawLine(x2,y1,x2,y2,c);
-    lcddev.select(0);
+    LCD_Select();
+    _LCD_HLine(x1,x2,y1,c);
+    if (y2 != y1)
+        _LCD_HLine(x1,x2,y2,c);
+    if (y2 > y1 + 1 || y1 > y2 + 1) {   // Sides, without the corners
+        int ya = y1 < y2 ? y1 + 1 : y2 + 1;
+        int yb = y1 < y2 ? y2 - 1 : y1 - 1;
+        _LCD_VLine(x1,ya,yb,c);
+        if (x2 != x1)
+            _LCD_VLine(x2,ya,yb,c);
+    }
+    LCD_Release();
 }
 
 //===========================================================================
@@ -480,17 +421,10 @@ void LCD_DrawRectangle(u16 x1, u16 y1, u16 x2, u16 y2, u16 c)
 //===========================================================================
 static void _LCD_Fill(u16 sx,u16 sy,u16 ex,u16 ey,u16 color)
 {
-    u16 i,j;
     u16 width=ex-sx+1;
     u16 height=ey-sy+1;
     LCD_SetWindow(sx,sy,ex,ey);
-    LCD_WriteData16_Prepare();
-    for(i=0;i<height;i++)
-    {
-        for(j=0;j<width;j++)
-        LCD_WriteData16(color);
-    }
-    LCD_WriteData16_End();
+    LCD_FillPixels(color, (uint32_t)width * height);
 }
 
 //===========================================================================
@@ -498,9 +432,53 @@ static void _LCD_Fill(u16 sx,u16 sy,u16 ex,u16 ey,u16 color)
 //===========================================================================
 void LCD_DrawFillRectangle(u16 x1, u16 y1, u16 x2, u16 y2, u16 c)
 {
-    lcddev.select(1);
+    LCD_Select();
     _LCD_Fill(x1,y1,x2,y2,c);
-    lcddev.select(0);
+    LCD_Release();
+}
+
+//===========================================================================
+// Clipping for the filled shapes.
+// Circles and filled triangles are drawn as one horizontal span per row, and
+// each span is cut to the clip rectangle, so a shape may run off the edge of
+// the display (or of a widget set with LCD_SetClip()) without wrapping.
+//===========================================================================
+static u8  clip_on;
+static int clip_x0, clip_y0, clip_x1, clip_y1;
+
+void LCD_SetClip(u16 x1, u16 y1, u16 x2, u16 y2)
+{
+    clip_x0 = x1;
+    clip_y0 = y1;
+    clip_x1 = x2;
+    clip_y1 = y2;
+    clip_on = 1;
+}
+
+void LCD_ClearClip(void)
+{
+    clip_on = 0;
+}
+
+static void _LCD_Span(int xa, int xb, int y, u16 c)
+{
+    int x0 = 0, y0 = 0;
+    int x1 = lcddev.width - 1, y1 = lcddev.height - 1;
+    if (clip_on) {
+        if (clip_x0 > x0) x0 = clip_x0;
+        if (clip_y0 > y0) y0 = clip_y0;
+        if (clip_x1 < x1) x1 = clip_x1;
+        if (clip_y1 < y1) y1 = clip_y1;
+    }
+    if (y < y0 || y > y1)
+        return;
+    if (xa < x0)
+        xa = x0;
+    if (xb > x1)
+        xb = x1;
+    if (xa > xb)
+        return;
+    _LCD_Fill(xa,y,xb,y,c);
 }
 
 static void _draw_circle_8(int xc, int yc, int x, int y, u16 c)
@@ -518,22 +496,30 @@ static void _draw_circle_8(int xc, int yc, int x, int y, u16 c)
 //===========================================================================
 // Draw a circle of color c and radius r at center (xc,yc).
 // The fill parameter indicates if it is to be filled.
+// A filled circle is one span per row. The rows yc+-x are drawn as x steps,
+// and the rows yc+-y once y is about to step (their widest point), so no
+// pixel is sent twice.
 //===========================================================================
 void LCD_Circle(u16 xc, u16 yc, u16 r, u16 fill, u16 c)
 {
-    lcddev.select(1);
-    int x = 0, y = r, yi, d;
+    LCD_Select();
+    int x = 0, y = r, d;
     d = 3 - 2 * r;
 
     if (fill)
     {
         while (x <= y) {
-            for (yi = x; yi <= y; yi++)
-                _draw_circle_8(xc, yc, x, yi, c);
+            _LCD_Span(xc - y, xc + y, yc + x, c);
+            if (x)
+                _LCD_Span(xc - y, xc + y, yc - x, c);
 
             if (d < 0) {
                 d = d + 4 * x + 6;
             } else {
+                if (y != x) {
+                    _LCD_Span(xc - x, xc + x, yc + y, c);
+                    _LCD_Span(xc - x, xc + x, yc - y, c);
+                }
                 d = d + 4 * (x - y) + 10;
                 y--;
             }
@@ -552,7 +538,7 @@ void LCD_Circle(u16 xc, u16 yc, u16 r, u16 fill, u16 c)
             x++;
         }
     }
-    lcddev.select(0);
+    LCD_Release();
 }
 
 //===========================================================================
@@ -560,16 +546,16 @@ void LCD_Circle(u16 xc, u16 yc, u16 r, u16 fill, u16 c)
 //===========================================================================
 void LCD_DrawTriangle(u16 x0,u16 y0,  u16 x1,u16 y1,  u16 x2,u16 y2, u16 c)
 {
-    lcddev.select(1);
+    LCD_Select();
     _LCD_DrawLine(x0,y0,x1,y1,c);
     _LCD_DrawLine(x1,y1,x2,y2,c);
     _LCD_DrawLine(x2,y2,x0,y0,c);
-    lcddev.select(0);
+    LCD_Release();
 }
 
-static void _swap(u16 *a, u16 *b)
+static void _swap(int *a, int *b)
 {
-    u16 tmp;
+    int tmp;
     tmp = *a;
     *a = *b;
     *b = tmp;
@@ -577,1438 +563,124 @@ static void _swap(u16 *a, u16 *b)
 
 //===========================================================================
 // Draw a filled triangle of color c with vertices at (x0,y0), (x1,y1), (x2,y2).
+// The vertices are sorted by y and the triangle is drawn one span per row,
+// between the long edge (0 to 2) and the short edges (0 to 1, then 1 to 2).
 //===========================================================================
 void LCD_DrawFillTriangle(u16 x0,u16 y0, u16 x1,u16 y1, u16 x2,u16 y2, u16 c)
 {
-    lcddev.select(1);
-    u16 a, b, y, last;
-    int dx01, dy01, dx02, dy02, dx12, dy12;
-    long sa = 0;
-    long sb = 0;
-    if (y0 > y1)
-    {
-    _swap(&y0,&y1);
-        _swap(&x0,&x1);
-    }
-    if (y1 > y2)
-    {
-    _swap(&y2,&y1);
-        _swap(&x2,&x1);
-    }
-  if (y0 > y1)
-    {
-    _swap(&y0,&y1);
-        _swap(&x0,&x1);
-  }
-    if(y0 == y2)
-    {
-        a = b = x0;
-        if(x1 < a)
-    {
-            a = x1;
-    }
-    else if(x1 > b)
-    {
-            b = x1;
-    }
-    if(x2 < a)
-    {
-            a = x2;
-    }
-        else if(x2 > b)
-    {
-            b = x2;
-    }
-        _LCD_Fill(a,y0,b,y0,c);
-    return;
-    }
-    dx01 = x1 - x0;
-    dy01 = y1 - y0;
-    dx02 = x2 - x0;
-    dy02 = y2 - y0;
-    dx12 = x2 - x1;
-    dy12 = y2 - y1;
-
-    if(y1 == y2)
-    {
-        last = y1;
-    }
-  else
-    {
-        last = y1-1;
+    int xa = x0, ya = y0, xb = x1, yb = y1, xc = x2, yc = y2;
+    int a, b, y, last;
+    long sa = 0, sb = 0;
+
+    if (ya > yb) { _swap(&ya,&yb); _swap(&xa,&xb); }
+    if (yb > yc) { _swap(&yb,&yc); _swap(&xb,&xc); }
+    if (ya > yb) { _swap(&ya,&yb); _swap(&xa,&xb); }
+
+    LCD_Select();
+    if (ya == yc) {             // All on one row
+        a = b = xa;
+        if (xb < a) a = xb; else if (xb > b) b = xb;
+        if (xc < a) a = xc; else if (xc > b) b = xc;
+        _LCD_Span(a,b,ya,c);
+        LCD_Release();
+        return;
     }
-    for(y=y0; y<=last; y++)
-    {
-        a = x0 + sa / dy01;
-        b = x0 + sb / dy02;
-        sa += dx01;
-    sb += dx02;
-    if(a > b)
-    {
+
+    // The row of the middle vertex belongs to the lower half, unless the
+    // lower half is empty.
+    last = (yb == yc) ? yb : yb - 1;
+    for(y=ya; y<=last; y++) {
+        a = xa + sa / (yb - ya);
+        b = xa + sb / (yc - ya);
+        sa += xb - xa;
+        sb += xc - xa;
+        if (a > b)
             _swap(&a,&b);
-        }
-        _LCD_Fill(a,y,b,y,c);
+        _LCD_Span(a,b,y,c);
     }
-    sa = dx12 * (y - y1);
-    sb = dx02 * (y - y0);
-    for(; y<=y2; y++)
-    {
-        a = x1 + sa / dy12;
-        b = x0 + sb / dy02;
-        sa += dx12;
-        sb += dx02;
-        if(a > b)
-        {
+    sa = (long)(xc - xb) * (y - yb);
+    sb = (long)(xc - xa) * (y - ya);
+    for(; y<=yc; y++) {
+        a = xb + sa / (yc - yb);
+        b = xa + sb / (yc - ya);
+        sa += xc - xb;
+        sb += xc - xa;
+        if (a > b)
             _swap(&a,&b);
-        }
-        _LCD_Fill(a,y,b,y,c);
+        _LCD_Span(a,b,y,c);
     }
-    lcddev.select(0);
+    LCD_Release();
 }
 
-// A 12x6 font
-const unsigned char asc2_1206[95][12]={
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*" ",0*/
-{0x00,0x00,0x04,0x04,0x04,0x04,0x04,0x04,0x00,0x04,0x00,0x00},/*"!",1*/
-{0x00,0x14,0x0A,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*""",2*/
-{0x00,0x00,0x14,0x14,0x3F,0x14,0x0A,0x3F,0x0A,0x0A,0x00,0x00},/*"#",3*/
-{0x00,0x04,0x1E,0x15,0x05,0x06,0x0C,0x14,0x15,0x0F,0x04,0x00},/*"$",4*/
-{0x00,0x00,0x12,0x15,0x0D,0x0A,0x14,0x2C,0x2A,0x12,0x00,0x00},/*"%",5*/
-{0x00,0x00,0x04,0x0A,0x0A,0x1E,0x15,0x15,0x09,0x36,0x00,0x00},/*"&",6*/
-{0x00,0x02,0x02,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"'",7*/
-{0x00,0x20,0x10,0x08,0x08,0x08,0x08,0x08,0x08,0x10,0x20,0x00},/*"(",8*/
-{0x00,0x02,0x04,0x08,0x08,0x08,0x08,0x08,0x08,0x04,0x02,0x00},/*")",9*/
-{0x00,0x00,0x00,0x04,0x15,0x0E,0x0E,0x15,0x04,0x00,0x00,0x00},/*"*",10*/
-{0x00,0x00,0x04,0x04,0x04,0x1F,0x04,0x04,0x04,0x00,0x00,0x00},/*"+",11*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x01},/*",",12*/
-{0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x00,0x00},/*"-",13*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00},/*".",14*/
-{0x00,0x10,0x08,0x08,0x08,0x04,0x04,0x02,0x02,0x02,0x01,0x00},/*"/",15*/
-{0x00,0x00,0x0E,0x11,0x11,0x11,0x11,0x11,0x11,0x0E,0x00,0x00},/*"0",16*/
-{0x00,0x00,0x04,0x06,0x04,0x04,0x04,0x04,0x04,0x0E,0x00,0x00},/*"1",17*/
-{0x00,0x00,0x0E,0x11,0x11,0x08,0x04,0x02,0x01,0x1F,0x00,0x00},/*"2",18*/
-{0x00,0x00,0x0E,0x11,0x10,0x0C,0x10,0x10,0x11,0x0E,0x00,0x00},/*"3",19*/
-{0x00,0x00,0x08,0x0C,0x0A,0x0A,0x09,0x1E,0x08,0x18,0x00,0x00},/*"4",20*/
-{0x00,0x00,0x1F,0x01,0x01,0x0F,0x10,0x10,0x11,0x0E,0x00,0x00},/*"5",21*/
-{0x00,0x00,0x0E,0x09,0x01,0x0F,0x11,0x11,0x11,0x0E,0x00,0x00},/*"6",22*/
-{0x00,0x00,0x1F,0x09,0x08,0x04,0x04,0x04,0x04,0x04,0x00,0x00},/*"7",23*/
-{0x00,0x00,0x0E,0x11,0x11,0x0E,0x11,0x11,0x11,0x0E,0x00,0x00},/*"8",24*/
-{0x00,0x00,0x0E,0x11,0x11,0x11,0x1E,0x10,0x12,0x0E,0x00,0x00},/*"9",25*/
-{0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x04,0x00,0x00},/*":",26*/
-{0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x04,0x00},/*";",27*/
-{0x00,0x20,0x10,0x08,0x04,0x02,0x04,0x08,0x10,0x20,0x00,0x00},/*"<",28*/
-{0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x1F,0x00,0x00,0x00,0x00},/*"=",29*/
-{0x00,0x02,0x04,0x08,0x10,0x20,0x10,0x08,0x04,0x02,0x00,0x00},/*">",30*/
-{0x00,0x00,0x0E,0x11,0x11,0x08,0x04,0x04,0x00,0x04,0x00,0x00},/*"?",31*/
-{0x00,0x00,0x0E,0x11,0x19,0x15,0x15,0x1D,0x01,0x1E,0x00,0x00},/*"@",32*/
-{0x00,0x00,0x04,0x04,0x0C,0x0A,0x0A,0x1E,0x12,0x33,0x00,0x00},/*"A",33*/
-{0x00,0x00,0x0F,0x12,0x12,0x0E,0x12,0x12,0x12,0x0F,0x00,0x00},/*"B",34*/
-{0x00,0x00,0x1E,0x11,0x01,0x01,0x01,0x01,0x11,0x0E,0x00,0x00},/*"C",35*/
-{0x00,0x00,0x0F,0x12,0x12,0x12,0x12,0x12,0x12,0x0F,0x00,0x00},/*"D",36*/
-{0x00,0x00,0x1F,0x12,0x0A,0x0E,0x0A,0x02,0x12,0x1F,0x00,0x00},/*"E",37*/
-{0x00,0x00,0x1F,0x12,0x0A,0x0E,0x0A,0x02,0x02,0x07,0x00,0x00},/*"F",38*/
-{0x00,0x00,0x1C,0x12,0x01,0x01,0x39,0x11,0x12,0x0C,0x00,0x00},/*"G",39*/
-{0x00,0x00,0x33,0x12,0x12,0x1E,0x12,0x12,0x12,0x33,0x00,0x00},/*"H",40*/
-{0x00,0x00,0x1F,0x04,0x04,0x04,0x04,0x04,0x04,0x1F,0x00,0x00},/*"I",41*/
-{0x00,0x00,0x3E,0x08,0x08,0x08,0x08,0x08,0x08,0x09,0x07,0x00},/*"J",42*/
-{0x00,0x00,0x37,0x12,0x0A,0x06,0x0A,0x0A,0x12,0x37,0x00,0x00},/*"K",43*/
-{0x00,0x00,0x07,0x02,0x02,0x02,0x02,0x02,0x22,0x3F,0x00,0x00},/*"L",44*/
-{0x00,0x00,0x1B,0x1B,0x1B,0x1B,0x15,0x15,0x15,0x15,0x00,0x00},/*"M",45*/
-{0x00,0x00,0x3B,0x12,0x16,0x16,0x1A,0x1A,0x12,0x17,0x00,0x00},/*"N",46*/
-{0x00,0x00,0x0E,0x11,0x11,0x11,0x11,0x11,0x11,0x0E,0x00,0x00},/*"O",47*/
-{0x00,0x00,0x0F,0x12,0x12,0x0E,0x02,0x02,0x02,0x07,0x00,0x00},/*"P",48*/
-{0x00,0x00,0x0E,0x11,0x11,0x11,0x11,0x17,0x19,0x0E,0x18,0x00},/*"Q",49*/
-{0x00,0x00,0x0F,0x12,0x12,0x0E,0x0A,0x12,0x12,0x37,0x00,0x00},/*"R",50*/
-{0x00,0x00,0x1E,0x11,0x01,0x06,0x08,0x10,0x11,0x0F,0x00,0x00},/*"S",51*/
-{0x00,0x00,0x1F,0x15,0x04,0x04,0x04,0x04,0x04,0x0E,0x00,0x00},/*"T",52*/
-{0x00,0x00,0x33,0x12,0x12,0x12,0x12,0x12,0x12,0x0C,0x00,0x00},/*"U",53*/
-{0x00,0x00,0x33,0x12,0x12,0x0A,0x0A,0x0C,0x04,0x04,0x00,0x00},/*"V",54*/
-{0x00,0x00,0x15,0x15,0x15,0x0E,0x0A,0x0A,0x0A,0x0A,0x00,0x00},/*"W",55*/
-{0x00,0x00,0x1B,0x0A,0x0A,0x04,0x04,0x0A,0x0A,0x1B,0x00,0x00},/*"X",56*/
-{0x00,0x00,0x1B,0x0A,0x0A,0x04,0x04,0x04,0x04,0x0E,0x00,0x00},/*"Y",57*/
-{0x00,0x00,0x1F,0x09,0x08,0x04,0x04,0x02,0x12,0x1F,0x00,0x00},/*"Z",58*/
-{0x00,0x1C,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x1C,0x00},/*"[",59*/
-{0x00,0x02,0x02,0x02,0x04,0x04,0x08,0x08,0x08,0x10,0x00,0x00},/*"\",60*/
-{0x00,0x0E,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x0E,0x00},/*"]",61*/
-{0x00,0x04,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"^",62*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F},/*"_",63*/
-{0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"`",64*/
-{0x00,0x00,0x00,0x00,0x00,0x0C,0x12,0x1C,0x12,0x3C,0x00,0x00},/*"a",65*/
-{0x00,0x00,0x03,0x02,0x02,0x0E,0x12,0x12,0x12,0x0E,0x00,0x00},/*"b",66*/
-{0x00,0x00,0x00,0x00,0x00,0x1C,0x12,0x02,0x02,0x1C,0x00,0x00},/*"c",67*/
-{0x00,0x00,0x18,0x10,0x10,0x1C,0x12,0x12,0x12,0x3C,0x00,0x00},/*"d",68*/
-{0x00,0x00,0x00,0x00,0x00,0x0C,0x12,0x1E,0x02,0x1C,0x00,0x00},/*"e",69*/
-{0x00,0x00,0x38,0x04,0x04,0x1E,0x04,0x04,0x04,0x1E,0x00,0x00},/*"f",70*/
-{0x00,0x00,0x00,0x00,0x00,0x3C,0x12,0x0C,0x02,0x1E,0x22,0x1C},/*"g",71*/
-{0x00,0x00,0x03,0x02,0x02,0x0E,0x12,0x12,0x12,0x37,0x00,0x00},/*"h",72*/
-{0x00,0x00,0x04,0x00,0x00,0x06,0x04,0x04,0x04,0x0E,0x00,0x00},/*"i",73*/
-{0x00,0x00,0x08,0x00,0x00,0x0C,0x08,0x08,0x08,0x08,0x08,0x07},/*"j",74*/
-{0x00,0x00,0x03,0x02,0x02,0x3A,0x0A,0x0E,0x12,0x37,0x00,0x00},/*"k",75*/
-{0x00,0x00,0x07,0x04,0x04,0x04,0x04,0x04,0x04,0x1F,0x00,0x00},/*"l",76*/
-{0x00,0x00,0x00,0x00,0x00,0x0F,0x15,0x15,0x15,0x15,0x00,0x00},/*"m",77*/
-{0x00,0x00,0x00,0x00,0x00,0x0F,0x12,0x12,0x12,0x37,0x00,0x00},/*"n",78*/
-{0x00,0x00,0x00,0x00,0x00,0x0C,0x12,0x12,0x12,0x0C,0x00,0x00},/*"o",79*/
-{0x00,0x00,0x00,0x00,0x00,0x0F,0x12,0x12,0x12,0x0E,0x02,0x07},/*"p",80*/
-{0x00,0x00,0x00,0x00,0x00,0x1C,0x12,0x12,0x12,0x1C,0x10,0x38},/*"q",81*/
-{0x00,0x00,0x00,0x00,0x00,0x1B,0x06,0x02,0x02,0x07,0x00,0x00},/*"r",82*/
-{0x00,0x00,0x00,0x00,0x00,0x1E,0x02,0x0C,0x10,0x1E,0x00,0x00},/*"s",83*/
-{0x00,0x00,0x00,0x04,0x04,0x0E,0x04,0x04,0x04,0x18,0x00,0x00},/*"t",84*/
-{0x00,0x00,0x00,0x00,0x00,0x1B,0x12,0x12,0x12,0x3C,0x00,0x00},/*"u",85*/
-{0x00,0x00,0x00,0x00,0x00,0x37,0x12,0x0A,0x0C,0x04,0x00,0x00},/*"v",86*/
-{0x00,0x00,0x00,0x00,0x00,0x15,0x15,0x0E,0x0A,0x0A,0x00,0x00},/*"w",87*/
-{0x00,0x00,0x00,0x00,0x00,0x1B,0x0A,0x04,0x0A,0x1B,0x00,0x00},/*"x",88*/
-{0x00,0x00,0x00,0x00,0x00,0x37,0x12,0x0A,0x0C,0x04,0x04,0x03},/*"y",89*/
-{0x00,0x00,0x00,0x00,0x00,0x1E,0x08,0x04,0x04,0x1E,0x00,0x00},/*"z",90*/
-{0x00,0x18,0x08,0x08,0x08,0x04,0x08,0x08,0x08,0x08,0x18,0x00},/*"{",91*/
-{0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08},/*"|",92*/
-{0x00,0x06,0x04,0x04,0x04,0x08,0x04,0x04,0x04,0x04,0x06,0x00},/*"}",93*/
-{0x02,0x25,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00} /*"~",94*/
-};
-
-// A 16x8 font
-const unsigned char asc2_1608[95][16]={
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*" ",0*/
-{0x00,0x00,0x00,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x00,0x00,0x18,0x18,0x00,0x00},/*"!",1*/
-{0x0,0x48,0xd8,0xd8,0xd8,0xd8,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},/*""",2*/
-{0x00,0x00,0x00,0x24,0x24,0x24,0x7F,0x12,0x12,0x12,0x7F,0x12,0x12,0x12,0x00,0x00},/*"#",3*/
-{0x00,0x00,0x08,0x1C,0x2A,0x2A,0x0A,0x0C,0x18,0x28,0x28,0x2A,0x2A,0x1C,0x08,0x08},/*"$",4*/
-{0x0,0x46,0xc6,0xc0,0xc0,0xc0,0xc0,0xbc,0x7e,0x6,0x6,0x6,0x6,0xc6,0xc4,0x0},/*"%",5*/
-{0x00,0x00,0x00,0x0C,0x12,0x12,0x12,0x0A,0x76,0x25,0x29,0x11,0x91,0x6E,0x00,0x00},/*"&",6*/
-{0x0,0x40,0xc0,0xc0,0xc0,0xc0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},/*"'",7*/
-{0x00,0x40,0x20,0x10,0x10,0x08,0x08,0x08,0x08,0x08,0x08,0x10,0x10,0x20,0x40,0x00},/*"(",8*/
-{0x00,0x02,0x04,0x08,0x08,0x10,0x10,0x10,0x10,0x10,0x10,0x08,0x08,0x04,0x02,0x00},/*")",9*/
-{0x00,0x00,0x00,0x00,0x08,0x08,0x6B,0x1C,0x1C,0x6B,0x08,0x08,0x00,0x00,0x00,0x00},/*"*",10*/
-{0x00,0x00,0x00,0x00,0x08,0x08,0x08,0x08,0x7F,0x08,0x08,0x08,0x08,0x00,0x00,0x00},/*"+",11*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x06,0x04,0x03},/*",",12*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"-",13*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x06,0x00,0x00},/*".",14*/
-{0x00,0x00,0x80,0x40,0x40,0x20,0x20,0x10,0x10,0x08,0x08,0x04,0x04,0x02,0x02,0x00},/*"/",15*/
-{0x0,0x7e,0xbe,0xc6,0xc6,0xc6,0xc6,0x84,0xc2,0xc6,0xc6,0xc6,0xc6,0xfa,0xfe,0x0},/*"0",16*/
-{0x0,0x1e,0x3c,0x30,0x30,0x30,0x30,0x10,0x20,0x30,0x30,0x30,0x30,0x7c,0xfe,0x0} ,/*"1",17*/
-{0x0,0x7e,0xbc,0xc0,0xc0,0xc0,0xc0,0xbc,0x7e,0x6,0x6,0x6,0x6,0x7a,0xfe,0x0}     ,/*"2",18*/
-{0x0,0x7e,0xfc,0xc0,0xc0,0xc0,0xc0,0xb8,0x7c,0xc0,0xc0,0xc0,0xc0,0xbc,0x7e,0x0} ,/*"3",19*/
-{0x0,0x82,0xc6,0xc6,0xc6,0xc6,0xc6,0xfa,0xbc,0xc0,0xc0,0xc0,0xc0,0xc0,0x80,0x0} ,/*"4",20*/
-{0x0,0xfe,0x7e,0x6,0x6,0x6,0x6,0x7e,0xbc,0xc0,0xc0,0xc0,0xc0,0xfc,0xfe,0x0} ,/*"5",21*/
-{0x0,0xfe,0x7e,0x6,0x6,0x6,0x6,0x7e,0xfa,0xc6,0xc6,0xc6,0xc6,0xfa,0xfe,0x0} ,/*"6",22*/
-{0x0,0xfe,0x7c,0x80,0xc0,0xc0,0xc0,0x80,0x40,0xc0,0xc0,0xc0,0xc0,0xc0,0x80,0x0} ,/*"7",23*/
-{0x0,0x7e,0xbe,0xc6,0xc6,0xc6,0xc6,0x7c,0x38,0x46,0xc6,0xc6,0xc6,0xfa,0x7c,0x0} ,/*"8",24*/
-{0x0,0x7e,0xbe,0xc6,0xc6,0xc6,0xc6,0xbe,0x7c,0xc0,0xc0,0xc0,0xc0,0xbc,0xfe,0x0} ,/*"9",25*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x18,0x00,0x00,0x00,0x00,0x18,0x18,0x00,0x00},/*":",26*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x08,0x08,0x04},/*";",27*/
-{0x00,0x00,0x00,0x40,0x20,0x10,0x08,0x04,0x02,0x04,0x08,0x10,0x20,0x40,0x00,0x00},/*"<",28*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,0x00,0x00},/*"=",29*/
-{0x00,0x00,0x00,0x02,0x04,0x08,0x10,0x20,0x40,0x20,0x10,0x08,0x04,0x02,0x00,0x00},/*">",30*/
-{0x0,0x7e,0xba,0xc6,0xc6,0xc2,0xc0,0xf8,0x68,0x18,0x18,0x18,0x8,0x10,0x18,0x0},/*"?",31*/
-{0x00,0x00,0x00,0x1C,0x22,0x5A,0x55,0x55,0x55,0x55,0x2D,0x42,0x22,0x1C,0x00,0x00},/*"@",32*/
-{0x0,0x7c,0xba,0xc6,0xc6,0xc6,0xc6,0xfe,0xfa,0xc6,0xc6,0xc6,0xc6,0xc6,0x82,0x0} ,/*"A",33*/
-{0x0,0x7e,0xfa,0xc6,0xc6,0xc6,0xc6,0x7e,0x3e,0x46,0xc6,0xc6,0xc6,0xfa,0x7e,0x0} ,/*"B",34*/
-{0x0,0xfc,0x7a,0x6,0x6,0x6,0x6,0x2,0x6,0x6,0x6,0x6,0x6,0x7a,0xfc,0x0} ,/*"C",35*/
-{0x0,0x7e,0xfa,0xc6,0xc6,0xc6,0xc6,0xc2,0x86,0xc6,0xc6,0xc6,0xc6,0xfa,0x7e,0x0} ,/*"D",36*/
-{0x0,0xfe,0x7a,0x6,0x6,0x6,0x6,0x7a,0x3c,0x6,0x6,0x6,0x6,0x7a,0xfe,0x0} ,/*"E",37*/
-{0x0,0xfe,0x7a,0x6,0x6,0x6,0x2,0x1c,0x3a,0x6,0x6,0x6,0x6,0x6,0x2,0x0},/*"F",38*/
-{0x0,0x7c,0xfa,0x6,0x6,0x6,0x6,0xe2,0x74,0x86,0xc6,0xc6,0xc6,0xbe,0x7c,0x0} ,/*"G",39*/
-{0x0,0x82,0xc6,0xc6,0xc6,0xc6,0xc6,0xbe,0x7a,0xc6,0xc6,0xc6,0xc6,0xc6,0x82,0x0} ,/*"H",40*/
-{0x0,0xfe,0x7c,0x10,0x30,0x30,0x30,0x20,0x10,0x30,0x30,0x30,0x10,0x6c,0xfe,0x0} ,/*"I",41*/
-{0x0,0xf0,0xe0,0x80,0xc0,0xc0,0xc0,0x40,0x80,0xc0,0xc0,0xc0,0xc0,0xbe,0x7c,0x0} ,/*"J",42*/
-{0x0,0x42,0x66,0x66,0x66,0x66,0x26,0x1e,0x3a,0x66,0x66,0x66,0x66,0x66,0x42,0x0} ,/*"K",43*/
-{0x0,0x2,0x6,0x6,0x6,0x6,0x6,0x2,0x6,0x6,0x6,0x6,0x6,0x7a,0xfe,0x0}             ,/*"L",44*/
-{0x0,0xfe,0xbe,0xd6,0xd6,0xd6,0xd6,0x86,0x44,0xc6,0xc6,0xc6,0xc6,0xc6,0x82,0x0} ,/*"M",45*/
-{0x0,0xfe,0xbe,0xc6,0xc6,0xc6,0xc6,0xc4,0x82,0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,0x0} ,/*"N",46*/
-{0x0,0x7e,0xbe,0xc6,0xc6,0xc6,0xc6,0x84,0xc2,0xc6,0xc6,0xc6,0xc6,0xfa,0xfe,0x0} ,/*"O",47*/
-{0x0,0x7e,0xfa,0xc6,0xc6,0xc6,0xc6,0x7e,0x7a,0x6,0x6,0x6,0x6,0x6,0x2,0x0} ,/*"P",48*/
-{0x0,0xfe,0xba,0xc6,0xc6,0xc6,0xc6,0xc6,0x44,0xc6,0xc6,0xd6,0xd6,0xba,0xfe,0x0} ,/*"Q",49*/
-{0x0,0x7e,0xbe,0xc6,0xc6,0xc6,0xc6,0x7e,0x3a,0x36,0x76,0x66,0xc6,0xc6,0x82,0x0} ,/*"R",50*/
-{0x0,0xfc,0x7e,0x6,0x6,0x6,0x6,0x7a,0xbc,0xc0,0xc0,0xc0,0xc0,0xbc,0x7e,0x0} ,/*"S",51*/
-{0x0,0xfe,0x7c,0x10,0x30,0x30,0x30,0x30,0x20,0x30,0x30,0x30,0x30,0x30,0x10,0x0} ,/*"T",52*/
-{0x0,0x82,0xc6,0xc6,0xc6,0xc6,0xc6,0xc2,0x84,0xc6,0xc6,0xc6,0xc6,0xfe,0x7c,0x0} ,/*"U",53*/
-{0x0,0x0,0x82,0xc6,0xc6,0xc6,0xc6,0xc2,0xc8,0xd8,0xd8,0xd8,0xd0,0xe0,0x60,0x0},/*"V",54*/
-{0x0,0x82,0xc6,0xc6,0xc6,0xc6,0xc6,0x82,0x46,0xd6,0xd6,0xd6,0xd6,0xba,0xfe,0x0} ,/*"W",55*/
-{0x0,0x82,0xc6,0xc6,0xc6,0xc6,0x86,0x7c,0x38,0x44,0xc6,0xc6,0xc6,0xc6,0x82,0x0},/*"X",56*/
-{0x0,0x82,0xc6,0xc6,0xc6,0xc6,0xc6,0x7a,0xbc,0xc0,0xc0,0xc0,0xc0,0xb8,0x70,0x0} ,/*"Y",57*/
-{0x00,0x00,0x00,0x7E,0x21,0x20,0x10,0x10,0x08,0x04,0x04,0x42,0x42,0x3F,0x00,0x00},/*"Z",58*/
-{0x00,0x78,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x78,0x00},/*"[",59*/
-{0x00,0x00,0x02,0x02,0x04,0x04,0x08,0x08,0x08,0x10,0x10,0x20,0x20,0x20,0x40,0x40},/*"\",60*/
-{0x00,0x1E,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x1E,0x00},/*"]",61*/
-{0x0,0x60,0xd0,0xd0,0xd0,0xd0,0xd0,0x60,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},/*"^",62*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF},/*"_",63*/
-{0x00,0x06,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"`",64*/
-{0x0,0x7c,0xba,0xc6,0xc6,0xc6,0xc6,0xfe,0xfa,0xc6,0xc6,0xc6,0xc6,0xc6,0x82,0x0} ,/*"a",65*/
-{0x0,0x7e,0xfa,0xc6,0xc6,0xc6,0xc6,0x7e,0x3e,0x46,0xc6,0xc6,0xc6,0xfa,0x7e,0x0} ,/*"b",66*/
-{0x0,0xfc,0x7a,0x6,0x6,0x6,0x6,0x2,0x6,0x6,0x6,0x6,0x6,0x7a,0xfc,0x0} ,/*"c",67*/
-{0x0,0x7e,0xfa,0xc6,0xc6,0xc6,0xc6,0xc2,0x86,0xc6,0xc6,0xc6,0xc6,0xfa,0x7e,0x0} ,/*"d",68*/
-{0x0,0xfe,0x7a,0x6,0x6,0x6,0x6,0x7a,0x3c,0x6,0x6,0x6,0x6,0x7a,0xfe,0x0} ,/*"e",69*/
-{0x0,0xfe,0x7a,0x6,0x6,0x6,0x2,0x1c,0x3a,0x6,0x6,0x6,0x6,0x6,0x2,0x0} ,/*"f",70*/
-{0x0,0x7c,0xfa,0x6,0x6,0x6,0x6,0xe2,0x74,0x86,0xc6,0xc6,0xc6,0xbe,0x7c,0x0} ,/*"g",71*/
-{0x0,0x82,0xc6,0xc6,0xc6,0xc6,0xc6,0xbe,0x7a,0xc6,0xc6,0xc6,0xc6,0xc6,0x82,0x0} ,/*"h",72*/
-{0x0,0xfe,0x7c,0x10,0x30,0x30,0x30,0x20,0x10,0x30,0x30,0x30,0x10,0x6c,0xfe,0x0} ,/*"i",73*/
-{0x0,0xf0,0xe0,0x80,0xc0,0xc0,0xc0,0x40,0x80,0xc0,0xc0,0xc0,0xc0,0xbe,0x7c,0x0} ,/*"j",74*/
-{0x0,0x42,0x66,0x66,0x66,0x66,0x26,0x1e,0x3a,0x66,0x66,0x66,0x66,0x66,0x42,0x0} ,/*"k",75*/
-{0x0,0x2,0x6,0x6,0x6,0x6,0x6,0x2,0x6,0x6,0x6,0x6,0x6,0x7a,0xfe,0x0}             ,/*"l",76*/
-{0x0,0xfe,0xbe,0xd6,0xd6,0xd6,0xd6,0x86,0x44,0xc6,0xc6,0xc6,0xc6,0xc6,0x82,0x0} ,/*"m",77*/
-{0x0,0xfe,0xbe,0xc6,0xc6,0xc6,0xc6,0xc4,0x82,0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,0x0} ,/*"n",78*/
-{0x0,0x7e,0xbe,0xc6,0xc6,0xc6,0xc6,0x84,0xc2,0xc6,0xc6,0xc6,0xc6,0xfa,0xfe,0x0} ,/*"o",79*/
-{0x0,0x7e,0xfa,0xc6,0xc6,0xc6,0xc6,0x7e,0x7a,0x6,0x6,0x6,0x6,0x6,0x2,0x0} ,/*"p",80*/
-{0x0,0xfe,0xba,0xc6,0xc6,0xc6,0xc6,0xc6,0x44,0xc6,0xc6,0xd6,0xd6,0xba,0xfe,0x0} ,/*"q",81*/
-{0x0,0x7e,0xbe,0xc6,0xc6,0xc6,0xc6,0x7e,0x3a,0x36,0x76,0x66,0xc6,0xc6,0x82,0x0} ,/*"r",82*/
-{0x0,0xfc,0x7e,0x6,0x6,0x6,0x6,0x7a,0xbc,0xc0,0xc0,0xc0,0xc0,0xbc,0x7e,0x0} ,/*"s",83*/
-{0x0,0xfe,0x7c,0x10,0x30,0x30,0x30,0x30,0x20,0x30,0x30,0x30,0x30,0x30,0x10,0x0} ,/*"t",84*/
-{0x0,0x82,0xc6,0xc6,0xc6,0xc6,0xc6,0xc2,0x84,0xc6,0xc6,0xc6,0xc6,0xfe,0x7c,0x0} ,/*"u",85*/
-{0x0,0x0,0x82,0xc6,0xc6,0xc6,0xc6,0xc2,0xc8,0xd8,0xd8,0xd8,0xd0,0xe0,0x60,0x0} ,/*"v",86*/
-{0x0,0x82,0xc6,0xc6,0xc6,0xc6,0xc6,0x82,0x46,0xd6,0xd6,0xd6,0xd6,0xba,0xfe,0x0} ,/*"w",87*/
-{0x0,0x82,0xc6,0xc6,0xc6,0xc6,0x86,0x7c,0x38,0x44,0xc6,0xc6,0xc6,0xc6,0x82,0x0} ,/*"x",88*/
-{0x0,0x82,0xc6,0xc6,0xc6,0xc6,0xc6,0x7a,0xbc,0xc0,0xc0,0xc0,0xc0,0xb8,0x70,0x0} ,/*"y",89*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x22,0x10,0x08,0x08,0x44,0x7E,0x00,0x00},/*"z",90*/
-{0x00,0xC0,0x20,0x20,0x20,0x20,0x20,0x10,0x20,0x20,0x20,0x20,0x20,0x20,0xC0,0x00},/*"{",91*/
-{0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10},/*"|",92*/
-{0x00,0x06,0x08,0x08,0x08,0x08,0x08,0x10,0x08,0x08,0x08,0x08,0x08,0x08,0x06,0x00},/*"}",93*/
-{0x0C,0x32,0xC2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"~",94*/
-};
-
-const unsigned char asc2_3216[95][64]={
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*" ",0*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x80,0x03,0x80,0x03,0x80,
- 0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,
- 0x01,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,
- 0x03,0xC0,0x03,0xC0,0x01,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"!",1*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x38,0x07,0x38,0x0F,0x78,0x0E,0x70,0x1C,0xE0,
- 0x18,0xC0,0x10,0x80,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*""",2*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x08,0x04,0x08,
- 0x04,0x08,0x04,0x08,0x04,0x08,0x7F,0xFE,0x7F,0xFE,0x08,0x10,0x08,0x10,0x08,0x10,
- 0x08,0x10,0x08,0x10,0x08,0x10,0x08,0x10,0x7F,0xFE,0x7F,0xFE,0x10,0x20,0x10,0x20,
- 0x10,0x20,0x10,0x20,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"#",3*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x80,0x03,0xE0,0x06,0x98,
- 0x08,0x8C,0x18,0x8C,0x18,0x9C,0x18,0x9C,0x1C,0x80,0x0E,0x80,0x07,0x80,0x03,0xC0,
- 0x01,0xE0,0x00,0xF0,0x00,0xB8,0x00,0x9C,0x00,0x8C,0x38,0x8C,0x38,0x8C,0x30,0x8C,
- 0x30,0x88,0x18,0xB0,0x07,0xE0,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x00,0x00,0x00},/*"$",4*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x08,0x6C,0x18,
- 0xC6,0x10,0xC6,0x30,0xC6,0x20,0xC6,0x20,0xC6,0x40,0xC6,0x40,0xC6,0x80,0x6C,0xB8,
- 0x39,0xEC,0x01,0x44,0x01,0xC6,0x02,0xC6,0x02,0xC6,0x04,0xC6,0x04,0xC6,0x0C,0xC6,
- 0x08,0x44,0x18,0x6C,0x10,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"%",5*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x19,0x80,
- 0x31,0x80,0x31,0x80,0x31,0x80,0x31,0x80,0x31,0x00,0x33,0x00,0x1E,0x00,0x18,0x7C,
- 0x38,0x10,0x6C,0x10,0x4C,0x10,0xC6,0x20,0xC6,0x20,0xC3,0x20,0xC3,0xC0,0xC1,0xC2,
- 0x60,0xC2,0x71,0x64,0x1E,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"&",6*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x3C,0x00,0x3C,0x00,0x0C,0x00,0x0C,0x00,
- 0x08,0x00,0x30,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"'",7*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x04,0x00,0x08,0x00,0x10,0x00,0x30,
- 0x00,0x20,0x00,0x60,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x01,0x80,0x01,0x80,0x01,0x80,
- 0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x00,0xC0,0x00,0xC0,0x00,0xC0,
- 0x00,0x60,0x00,0x60,0x00,0x30,0x00,0x10,0x00,0x08,0x00,0x04,0x00,0x02,0x00,0x00},/*"(",8*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x10,0x00,0x08,0x00,0x0C,0x00,
- 0x04,0x00,0x06,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x01,0x80,0x01,0x80,0x01,0x80,
- 0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x03,0x00,0x03,0x00,0x03,0x00,
- 0x06,0x00,0x06,0x00,0x0C,0x00,0x08,0x00,0x10,0x00,0x20,0x00,0x40,0x00,0x00,0x00},/*")",9*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x80,0x01,0xC0,0x01,0xC0,0x00,0x80,0x38,0x8E,0x3C,0x9E,0x1E,0xBC,0x03,0xE0,
- 0x00,0x80,0x03,0xE0,0x1E,0xBC,0x3C,0x9E,0x38,0x8E,0x00,0x80,0x01,0xC0,0x01,0xC0,
- 0x01,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"*",10*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,
- 0x3F,0xFE,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"+",11*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x38,0x00,0x3C,0x00,0x3C,0x00,0x0C,0x00,0x0C,0x00,0x08,0x00,0x30,0x00,0x60,0x00},/*",",12*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x7F,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"-",13*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,
- 0x3C,0x00,0x3C,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*".",14*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x06,0x00,0x04,0x00,0x0C,0x00,0x08,
- 0x00,0x18,0x00,0x10,0x00,0x30,0x00,0x20,0x00,0x60,0x00,0x40,0x00,0xC0,0x00,0x80,
- 0x01,0x80,0x01,0x00,0x03,0x00,0x02,0x00,0x06,0x00,0x04,0x00,0x0C,0x00,0x08,0x00,
- 0x18,0x00,0x10,0x00,0x30,0x00,0x20,0x00,0x60,0x00,0x40,0x00,0x00,0x00,0x00,0x00},/*"/",15*/
- {0x0,0x0,0x7f,0xfc,0xbf,0xfa,0xdf,0xf6,0xef,0xee,0xf0,0x1e,0xf0,0x1e,0xf0,0x1e,0xf0,0x1e,0xf0,0x1e,0xf0,0x1e,0x70,0x1c,0xb0,0x1a,0xd0,0x16,0xe0,0xe,0xe0,0xe,0xd0,0x16,0xb0,0x1a,0x70,0x1c,0xf0,0x1e,0xf0,0x1e,0xf0,0x1e,0xf0,0x1e,0xf0,0x1e,0xf0,0x1e,0xf0,0x1e,0xf0,0x1e,0xef,0xee,0xdf,0xf6,0xbf,0xfa,0x7f,0xfc,0x0,0x0} ,/*"0",16*/
- {0x0,0x0,0x3,0xfc,0x5,0xf8,0x6,0xf0,0x7,0x60,0x7,0x80,0x7,0x80,0x7,0x80,0x7,0x80,0x7,0x80,0x7,0x80,0x3,0x80,0x5,0x80,0x6,0x80,0x7,0x0,0x7,0x0,0x6,0x80,0x5,0x80,0x3,0x80,0x7,0x80,0x7,0x80,0x7,0x80,0x7,0x80,0x7,0x80,0x7,0x80,0x7,0x80,0x3,0x80,0x1d,0x60,0x3e,0xf0,0x7f,0xf8,0xff,0xfc,0x0,0x0} ,/*"1",17*/
- {0x0,0x0,0x7f,0xfe,0xbf,0xfc,0xdf,0xf8,0xef,0xf0,0xf0,0x0,0xf0,0x0,0xf0,0x0,0xf0,0x0,0xf0,0x0,0xf0,0x0,0xf0,0x0,0xf0,0x0,0x70,0x0,0x2f,0xe0,0x1f,0xf0,0x1f,0xf0,0xf,0xe8,0x0,0x1c,0x0,0x1e,0x0,0x1e,0x0,0x1e,0x0,0x1e,0x0,0x1e,0x0,0x1e,0x0,0x1e,0x0,0x1e,0x1f,0xee,0x3f,0xf6,0x7f,0xfa,0xff,0xfc,0x0,0x0} ,/*"2",18*/
- {0x0,0x0,0x7f,0xfc,0xff,0xf8,0xff,0xf0,0xff,0xe0,0xf0,0x0,0xf0,0x0,0xf0,0x0,0xf0,0x0,0xf0,0x0,0xf0,0x0,0x70,0x0,0xb0,0x0,0xdf,0xf0,0xef,0xe0,0xef,0xc0,0xd7,0x80,0xb0,0x0,0x70,0x0,0xf0,0x0,0xf0,0x0,0xf0,0x0,0xf0,0x0,0xf0,0x0,0xf0,0x0,0xf0,0x0,0xf0,0x0,0xef,0xe0,0xdf,0xf0,0xbf,0xf8,0x7f,0xfc,0x0,0x0} ,/*"3",19*/
- {0x0,0x0,0x0,0x0,0x80,0x2,0xc0,0x6,0xe0,0xe,0xf0,0x1e,0xf0,0x1e,0xf0,0x1e,0xf0,0x1e,0xf0,0x1e,0xf0,0x1e,0x70,0x1c,0xb0,0x18,0xdf,0xf0,0xef,0xe0,0xef,0xc0,0xdf,0x80,0xb0,0x0,0x70,0x0,0xf0,0x0,0xf0,0x0,0xf0,0x0,0xf0,0x0,0xf0,0x0,0xf0,0x0,0xf0,0x0,0xf0,0x0,0xe0,0x0,0xc0,0x0,0x80,0x0,0x0,0x0,0x0,0x0} ,/*"4",20*/
- {0x0,0x0,0xff,0xfc,0x7f,0xfa,0x3f,0xf6,0x1f,0xee,0x0,0x1e,0x0,0x1e,0x0,0x1e,0x0,0x1e,0x0,0x1e,0x0,0x1e,0x0,0x1e,0x0,0x1e,0x0,0x1c,0xf,0xe8,0x1f,0xf0,0x1f,0xf0,0x2f,0xe0,0x70,0x0,0xf0,0x0,0xf0,0x0,0xf0,0x0,0xf0,0x0,0xf0,0x0,0xf0,0x0,0xf0,0x0,0xf0,0x0,0xef,0xf0,0xdf,0xf8,0xbf,0xfc,0x7f,0xfe,0x0,0x0} ,/*"5",21*/
- {0x0,0x0,0xff,0xfc,0x7f,0xfa,0x3f,0xf6,0x1f,0xee,0x0,0x1e,0x0,0x1e,0x0,0x1e,0x0,0x1e,0x0,0x1e,0x0,0x1e,0x0,0x1c,0x0,0x1a,0x0,0x16,0xf,0xce,0x1f,0xfe,0x3f,0xfe,0x7f,0xce,0xf0,0x16,0xf0,0x1a,0xf0,0x1c,0xf0,0x1e,0xf0,0x1e,0xf0,0x1e,0xf0,0x1e,0xf0,0x1e,0xf0,0x1e,0xef,0xee,0xdf,0xf6,0xbf,0xfa,0x7f,0xfc,0x0,0x0} ,/*"6",22*/
- {0x0,0x0,0x7f,0xfe,0xbf,0xfc,0xdf,0xf8,0xef,0xf0,0xf0,0x0,0xf0,0x0,0xf0,0x0,0xf0,0x0,0xf0,0x0,0xf0,0x0,0x70,0x0,0xb0,0x0,0xd0,0x0,0xe0,0x0,0xf0,0x0,0xf0,0x0,0xe0,0x0,0xd0,0x0,0xb0,0x0,0x70,0x0,0xf0,0x0,0xf0,0x0,0xf0,0x0,0xf0,0x0,0xf0,0x0,0xf0,0x0,0xf0,0x0,0xe0,0x0,0xc0,0x0,0x80,0x0,0x0,0x0} ,/*"7",23*/
- {0x0,0x0,0x7f,0xfc,0xbf,0xfa,0xdf,0xf6,0xef,0xee,0xf0,0x1e,0xf0,0x1e,0xf0,0x1e,0xf0,0x1e,0xf0,0x1e,0xf0,0x1e,0x70,0x1c,0xb0,0x1a,0xd7,0xd6,0xef,0xee,0xef,0xee,0xd7,0xd6,0xb0,0x1a,0x70,0x1c,0xf0,0x1e,0xf0,0x1e,0xf0,0x1e,0xf0,0x1e,0xf0,0x1e,0xf0,0x1e,0xf0,0x1e,0xf0,0x1e,0xef,0xee,0xdf,0xf6,0xbf,0xfa,0x7f,0xfc,0x0,0x0} ,/*"8",24*/
- {0x0,0x0,0x7f,0xfc,0xbf,0xfa,0xdf,0xf6,0xef,0xee,0xf0,0x1e,0xf0,0x1e,0xf0,0x1e,0xf0,0x1e,0xf0,0x1e,0xf0,0x1e,0x70,0x1e,0xb0,0x1e,0xd0,0x1e,0xe7,0xfc,0xff,0xf8,0xff,0xf0,0xe7,0xe0,0xd0,0x0,0xb0,0x0,0x70,0x0,0xf0,0x0,0xf0,0x0,0xf0,0x0,0xf0,0x0,0xf0,0x0,0xf0,0x0,0xef,0xf0,0xdf,0xf8,0xbf,0xfc,0x7f,0xfe,0x0,0x0} ,/*"9",25*/
- {0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0xe0,0x7,0xe0,0x7,0xe0,0x7,0xe0,0x7,0xe0,0x7,0xe0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0xe0,0x7,0xe0,0x7,0xe0,0x7,0xe0,0x7,0xe0,0x7,0xe0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0} ,/*":",26*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x03,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x03,0x00,0x03,0x00,0x01,0x00,0x01,0x00,0x02,0x00,0x02,0x00,0x00,0x00},/*";",27*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x08,0x00,0x10,
- 0x00,0x20,0x00,0x60,0x00,0xC0,0x01,0x80,0x03,0x00,0x06,0x00,0x0C,0x00,0x18,0x00,
- 0x30,0x00,0x18,0x00,0x0C,0x00,0x06,0x00,0x03,0x00,0x01,0x80,0x00,0xC0,0x00,0x60,
- 0x00,0x20,0x00,0x10,0x00,0x08,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"<",28*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFE,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"=",29*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x10,0x00,0x08,0x00,
- 0x04,0x00,0x06,0x00,0x03,0x00,0x01,0x80,0x00,0xC0,0x00,0x60,0x00,0x30,0x00,0x18,
- 0x00,0x0C,0x00,0x18,0x00,0x30,0x00,0x60,0x00,0xC0,0x01,0x80,0x03,0x00,0x06,0x00,
- 0x04,0x00,0x08,0x00,0x10,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*">",30*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xE0,0x0C,0x18,0x10,0x0C,
- 0x10,0x06,0x30,0x06,0x38,0x06,0x38,0x06,0x38,0x06,0x00,0x0C,0x00,0x38,0x00,0x60,
- 0x00,0x80,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x80,
- 0x03,0xC0,0x03,0xC0,0x01,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"?",31*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xE0,0x06,0x18,
- 0x08,0x0C,0x18,0x04,0x30,0xF4,0x31,0xB2,0x61,0x32,0x63,0x32,0x63,0x32,0x66,0x32,
- 0x66,0x22,0x66,0x22,0x66,0x64,0x66,0x64,0x66,0xA8,0x33,0x38,0x30,0x02,0x10,0x04,
- 0x18,0x0C,0x0C,0x18,0x03,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"@",32*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x03,0x80,0x03,0x80,
- 0x03,0x80,0x02,0x80,0x06,0xC0,0x04,0xC0,0x04,0xC0,0x04,0xC0,0x0C,0x60,0x08,0x60,
- 0x08,0x60,0x08,0x60,0x1F,0xF0,0x10,0x30,0x10,0x30,0x10,0x30,0x30,0x30,0x20,0x18,
- 0x20,0x18,0x60,0x18,0xF8,0x3E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"A",33*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xE0,0x18,0x38,
- 0x18,0x1C,0x18,0x0C,0x18,0x0C,0x18,0x0C,0x18,0x0C,0x18,0x18,0x18,0x30,0x1F,0xE0,
- 0x18,0x18,0x18,0x0C,0x18,0x04,0x18,0x06,0x18,0x06,0x18,0x06,0x18,0x06,0x18,0x06,
- 0x18,0x0C,0x18,0x18,0x7F,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"B",34*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xE4,0x06,0x1C,
- 0x08,0x0C,0x18,0x04,0x30,0x02,0x30,0x02,0x20,0x00,0x60,0x00,0x60,0x00,0x60,0x00,
- 0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x30,0x02,0x30,0x02,0x30,0x04,
- 0x18,0x0C,0x0C,0x18,0x03,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"C",35*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xC0,0x18,0x70,
- 0x18,0x18,0x18,0x0C,0x18,0x0C,0x18,0x0C,0x18,0x06,0x18,0x06,0x18,0x06,0x18,0x06,
- 0x18,0x06,0x18,0x06,0x18,0x06,0x18,0x06,0x18,0x06,0x18,0x0C,0x18,0x0C,0x18,0x08,
- 0x18,0x18,0x18,0x70,0x7F,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"D",36*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFC,0x18,0x0C,
- 0x18,0x04,0x18,0x06,0x18,0x02,0x18,0x00,0x18,0x10,0x18,0x10,0x18,0x30,0x1F,0xF0,
- 0x18,0x30,0x18,0x10,0x18,0x10,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x02,0x18,0x02,
- 0x18,0x04,0x18,0x0C,0x7F,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"E",37*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFE,0x18,0x0E,
- 0x18,0x02,0x18,0x03,0x18,0x01,0x18,0x00,0x18,0x08,0x18,0x08,0x18,0x18,0x1F,0xF8,
- 0x18,0x18,0x18,0x08,0x18,0x08,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,
- 0x18,0x00,0x18,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"F",38*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xC8,0x0E,0x38,
- 0x08,0x08,0x18,0x08,0x30,0x04,0x30,0x04,0x20,0x00,0x60,0x00,0x60,0x00,0x60,0x00,
- 0x60,0x00,0x60,0x00,0x60,0x3F,0x60,0x0C,0x60,0x0C,0x30,0x0C,0x30,0x0C,0x18,0x0C,
- 0x18,0x0C,0x0C,0x10,0x03,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"G",39*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x7E,0x30,0x18,
- 0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,
- 0x3F,0xF8,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,
- 0x30,0x18,0x30,0x18,0xFC,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"H",40*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xF8,0x01,0x80,
- 0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,
- 0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,
- 0x01,0x80,0x01,0x80,0x1F,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"I",41*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFE,0x00,0x60,
- 0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,
- 0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,
- 0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x70,0x60,0x70,0xC0,0x71,0x80,0x3F,0x00},/*"J",42*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x3E,0x18,0x18,
- 0x18,0x10,0x18,0x20,0x18,0x60,0x18,0x40,0x18,0x80,0x19,0x80,0x19,0x80,0x1B,0x80,
- 0x1D,0xC0,0x1C,0xC0,0x18,0xE0,0x18,0x60,0x18,0x70,0x18,0x30,0x18,0x38,0x18,0x18,
- 0x18,0x0C,0x18,0x0C,0x7E,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"K",43*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x18,0x00,
- 0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,
- 0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x02,0x18,0x02,
- 0x18,0x04,0x18,0x0C,0x7F,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"L",44*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x1F,0x38,0x1C,
- 0x38,0x1C,0x38,0x1C,0x38,0x3C,0x2C,0x2C,0x2C,0x2C,0x2C,0x2C,0x2C,0x6C,0x2E,0x4C,
- 0x26,0x4C,0x26,0x4C,0x26,0x4C,0x26,0x8C,0x23,0x8C,0x23,0x8C,0x23,0x8C,0x23,0x0C,
- 0x23,0x0C,0x21,0x0C,0xF9,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"M",45*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x3E,0x38,0x08,
- 0x3C,0x08,0x2C,0x08,0x2C,0x08,0x2E,0x08,0x26,0x08,0x27,0x08,0x23,0x08,0x23,0x88,
- 0x21,0x88,0x21,0xC8,0x20,0xC8,0x20,0xE8,0x20,0x68,0x20,0x78,0x20,0x38,0x20,0x38,
- 0x20,0x38,0x20,0x18,0xF8,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"N",46*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xC0,0x0C,0x30,
- 0x18,0x18,0x10,0x08,0x30,0x0C,0x30,0x0C,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,
- 0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x30,0x04,0x30,0x0C,0x10,0x08,
- 0x18,0x18,0x0C,0x30,0x03,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"O",47*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xF0,0x18,0x18,
- 0x18,0x0C,0x18,0x06,0x18,0x06,0x18,0x06,0x18,0x06,0x18,0x06,0x18,0x0C,0x18,0x18,
- 0x1F,0xF0,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,
- 0x18,0x00,0x18,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"P",48*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xC0,0x0C,0x30,
- 0x18,0x18,0x30,0x08,0x30,0x0C,0x30,0x04,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,
- 0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x27,0x86,0x34,0xCC,0x38,0x4C,
- 0x18,0x68,0x0C,0x70,0x03,0xE0,0x00,0x32,0x00,0x3E,0x00,0x1C,0x00,0x00,0x00,0x00},/*"Q",49*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xE0,0x18,0x38,
- 0x18,0x1C,0x18,0x0C,0x18,0x0C,0x18,0x0C,0x18,0x0C,0x18,0x18,0x18,0x30,0x1F,0xE0,
- 0x19,0xC0,0x18,0xC0,0x18,0xE0,0x18,0x60,0x18,0x60,0x18,0x70,0x18,0x30,0x18,0x30,
- 0x18,0x38,0x18,0x18,0x7E,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"R",50*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xE4,0x0C,0x1C,
- 0x18,0x0C,0x30,0x04,0x30,0x04,0x30,0x00,0x30,0x00,0x18,0x00,0x1E,0x00,0x07,0xC0,
- 0x01,0xF0,0x00,0x78,0x00,0x1C,0x00,0x0E,0x00,0x06,0x20,0x06,0x20,0x06,0x10,0x06,
- 0x18,0x0C,0x1C,0x18,0x13,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"S",51*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xFC,0x31,0x84,
- 0x21,0x86,0x41,0x82,0x41,0x82,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,
- 0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,
- 0x01,0x80,0x01,0x80,0x07,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"T",52*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x3E,0x30,0x08,
- 0x30,0x08,0x30,0x08,0x30,0x08,0x30,0x08,0x30,0x08,0x30,0x08,0x30,0x08,0x30,0x08,
- 0x30,0x08,0x30,0x08,0x30,0x08,0x30,0x08,0x30,0x08,0x30,0x08,0x30,0x08,0x30,0x08,
- 0x10,0x10,0x1C,0x20,0x07,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"U",53*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x1F,0x18,0x04,
- 0x18,0x04,0x18,0x04,0x0C,0x08,0x0C,0x08,0x0C,0x08,0x0C,0x08,0x06,0x10,0x06,0x10,
- 0x06,0x10,0x07,0x30,0x03,0x20,0x03,0x20,0x03,0x20,0x01,0xC0,0x01,0xC0,0x01,0xC0,
- 0x01,0xC0,0x00,0x80,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"V",54*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0xCF,0x61,0x86,
- 0x61,0x84,0x61,0x84,0x31,0x84,0x30,0x84,0x31,0xC4,0x31,0xC8,0x31,0xC8,0x31,0xC8,
- 0x32,0xC8,0x1A,0x48,0x1A,0x68,0x1A,0x70,0x1C,0x70,0x1C,0x70,0x1C,0x70,0x0C,0x30,
- 0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"W",55*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x7C,0x18,0x10,
- 0x1C,0x10,0x0C,0x20,0x0C,0x20,0x0E,0x40,0x06,0x40,0x07,0x80,0x03,0x80,0x03,0x80,
- 0x01,0x80,0x01,0xC0,0x02,0xC0,0x02,0xE0,0x04,0x60,0x04,0x60,0x08,0x30,0x08,0x30,
- 0x10,0x18,0x10,0x18,0x7C,0x3E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"X",56*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x3E,0x38,0x08,
- 0x18,0x08,0x18,0x10,0x0C,0x10,0x0C,0x30,0x0E,0x20,0x06,0x20,0x06,0x40,0x03,0x40,
- 0x03,0x40,0x03,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,
- 0x01,0x80,0x01,0x80,0x07,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"Y",57*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xFC,0x18,0x18,
- 0x10,0x18,0x20,0x30,0x20,0x70,0x00,0x60,0x00,0xE0,0x00,0xC0,0x01,0xC0,0x01,0x80,
- 0x03,0x80,0x03,0x00,0x07,0x00,0x06,0x00,0x0E,0x00,0x0C,0x00,0x1C,0x04,0x18,0x04,
- 0x38,0x08,0x30,0x18,0x7F,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"Z",58*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xFC,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,
- 0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,
- 0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,
- 0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x03,0xFC,0x00,0x00,0x00,0x00},/*"[",59*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x18,0x00,0x18,0x00,
- 0x08,0x00,0x0C,0x00,0x04,0x00,0x06,0x00,0x06,0x00,0x02,0x00,0x03,0x00,0x01,0x00,
- 0x01,0x80,0x01,0x80,0x00,0x80,0x00,0xC0,0x00,0x40,0x00,0x60,0x00,0x60,0x00,0x20,
- 0x00,0x30,0x00,0x10,0x00,0x18,0x00,0x18,0x00,0x08,0x00,0x0C,0x00,0x04,0x00,0x00},/*"\",60*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xC0,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,
- 0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,
- 0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,
- 0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x3F,0xC0,0x00,0x00,0x00,0x00},/*"]",61*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xE0,0x03,0x60,0x04,0x10,0x08,0x08,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"^",62*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF},/*"_",63*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0x00,0x03,0x00,0x00,0x80,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"`",64*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xC0,0x18,0x60,0x30,0x30,
- 0x30,0x30,0x00,0x30,0x01,0xF0,0x0E,0x30,0x38,0x30,0x30,0x30,0x60,0x30,0x60,0x30,
- 0x60,0x32,0x30,0xF2,0x1F,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"a",65*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x78,0x00,0x18,0x00,
- 0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0xF0,0x1B,0x18,0x1C,0x0C,
- 0x1C,0x06,0x18,0x06,0x18,0x06,0x18,0x06,0x18,0x06,0x18,0x06,0x18,0x06,0x18,0x04,
- 0x1C,0x0C,0x1E,0x18,0x13,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"b",66*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xE0,0x0E,0x30,0x18,0x18,
- 0x18,0x18,0x30,0x18,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x04,0x18,0x04,
- 0x18,0x08,0x0C,0x10,0x03,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"c",67*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x78,0x00,0x18,
- 0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x07,0xD8,0x0C,0x38,0x18,0x18,
- 0x18,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x10,0x18,
- 0x18,0x38,0x0C,0x5E,0x07,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"d",68*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xE0,0x0C,0x30,0x18,0x18,
- 0x10,0x08,0x30,0x0C,0x30,0x0C,0x3F,0xFC,0x30,0x00,0x30,0x00,0x30,0x00,0x18,0x04,
- 0x18,0x08,0x0E,0x18,0x03,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"e",69*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x01,0xC3,
- 0x01,0x03,0x03,0x03,0x03,0x00,0x03,0x00,0x03,0x00,0x3F,0xF8,0x03,0x00,0x03,0x00,
- 0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
- 0x03,0x00,0x03,0x00,0x1F,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"f",70*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xEE,0x0C,0x36,0x08,0x18,
- 0x18,0x18,0x18,0x18,0x18,0x18,0x08,0x18,0x0C,0x30,0x0F,0xE0,0x18,0x00,0x18,0x00,
- 0x0F,0xF0,0x0F,0xFC,0x10,0x0E,0x30,0x06,0x30,0x06,0x30,0x06,0x1C,0x1C,0x07,0xF0},/*"g",71*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x78,0x00,0x18,0x00,
- 0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x19,0xF0,0x1B,0x18,0x1C,0x0C,
- 0x18,0x0C,0x18,0x0C,0x18,0x0C,0x18,0x0C,0x18,0x0C,0x18,0x0C,0x18,0x0C,0x18,0x0C,
- 0x18,0x0C,0x18,0x0C,0x7E,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"h",72*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xC0,0x01,0xC0,
- 0x01,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x1F,0x80,0x01,0x80,0x01,0x80,
- 0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,
- 0x01,0x80,0x01,0x80,0x1F,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"i",73*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x1C,
- 0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x01,0xF8,0x00,0x18,0x00,0x18,
- 0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,
- 0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x18,0x30,0x18,0x60,0x0F,0xC0},/*"j",74*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x78,0x00,0x18,0x00,
- 0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x7C,0x18,0x30,0x18,0x60,
- 0x18,0xC0,0x18,0x80,0x19,0x80,0x1B,0x80,0x1C,0xC0,0x18,0xE0,0x18,0x60,0x18,0x30,
- 0x18,0x38,0x18,0x18,0x7E,0x3E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"k",75*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x1F,0x80,0x01,0x80,
- 0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,
- 0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,
- 0x01,0x80,0x01,0x80,0x1F,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"l",76*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x77,0x38,0x39,0xCC,0x31,0x8C,
- 0x31,0x8C,0x31,0x8C,0x31,0x8C,0x31,0x8C,0x31,0x8C,0x31,0x8C,0x31,0x8C,0x31,0x8C,
- 0x31,0x8C,0x31,0x8C,0x7B,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"m",77*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x78,0xF0,0x1B,0x18,0x1C,0x0C,
- 0x18,0x0C,0x18,0x0C,0x18,0x0C,0x18,0x0C,0x18,0x0C,0x18,0x0C,0x18,0x0C,0x18,0x0C,
- 0x18,0x0C,0x18,0x0C,0x7E,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"n",78*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xE0,0x0E,0x38,0x08,0x0C,
- 0x18,0x0C,0x30,0x06,0x30,0x06,0x30,0x06,0x30,0x06,0x30,0x06,0x30,0x06,0x18,0x0C,
- 0x18,0x0C,0x0C,0x18,0x03,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"o",79*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x79,0xF0,0x1A,0x18,0x1C,0x0C,
- 0x18,0x04,0x18,0x06,0x18,0x06,0x18,0x06,0x18,0x06,0x18,0x06,0x18,0x06,0x18,0x0C,
- 0x1C,0x0C,0x1E,0x18,0x19,0xE0,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x7E,0x00},/*"p",80*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xC4,0x0C,0x3C,0x18,0x1C,
- 0x18,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x10,0x0C,
- 0x18,0x1C,0x0C,0x3C,0x07,0xCC,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x3F},/*"q",81*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x7E,0x3C,0x06,0x66,0x06,0x86,
- 0x07,0x00,0x07,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,
- 0x06,0x00,0x06,0x00,0x7F,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"r",82*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xE4,0x0C,0x1C,0x18,0x0C,
- 0x18,0x04,0x18,0x00,0x0E,0x00,0x07,0xC0,0x01,0xF0,0x00,0x38,0x20,0x0C,0x20,0x0C,
- 0x30,0x0C,0x38,0x18,0x37,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"s",83*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x01,0x00,0x01,0x00,0x01,0x00,0x03,0x00,0x07,0x00,0x3F,0xF8,0x03,0x00,0x03,0x00,
- 0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x04,
- 0x03,0x04,0x01,0x88,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"t",84*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x04,0x78,0x3C,0x18,0x0C,0x18,0x0C,
- 0x18,0x0C,0x18,0x0C,0x18,0x0C,0x18,0x0C,0x18,0x0C,0x18,0x0C,0x18,0x0C,0x18,0x0C,
- 0x18,0x1C,0x0C,0x2F,0x07,0xC8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"u",85*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x3C,0x18,0x18,0x18,0x10,
- 0x1C,0x10,0x0C,0x20,0x0C,0x20,0x0E,0x40,0x06,0x40,0x06,0x40,0x07,0x80,0x03,0x80,
- 0x03,0x80,0x03,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"v",86*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0xEF,0x71,0xC6,0x30,0xC4,
- 0x31,0xC4,0x31,0xC4,0x19,0xC8,0x19,0xC8,0x1A,0x68,0x1A,0x68,0x0E,0x70,0x0E,0x70,
- 0x0E,0x70,0x04,0x20,0x04,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"w",87*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x7C,0x0E,0x10,0x0E,0x20,
- 0x07,0x20,0x03,0x40,0x03,0x80,0x01,0xC0,0x01,0xC0,0x02,0xE0,0x06,0x60,0x04,0x30,
- 0x08,0x30,0x18,0x18,0x7C,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"x",88*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x3E,0x18,0x18,0x18,0x10,
- 0x0C,0x10,0x0C,0x10,0x0C,0x20,0x06,0x20,0x06,0x20,0x03,0x40,0x03,0x40,0x03,0x40,
- 0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x00,0x01,0x00,0x01,0x00,0x32,0x00,0x3C,0x00},/*"y",89*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xF8,0x30,0x30,0x20,0x70,
- 0x20,0x60,0x00,0xC0,0x01,0xC0,0x01,0x80,0x03,0x00,0x07,0x00,0x0E,0x04,0x0C,0x04,
- 0x1C,0x0C,0x38,0x18,0x3F,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"z",90*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x00,0x10,0x00,0x20,0x00,0x20,0x00,0x20,
- 0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x40,
- 0x01,0x80,0x00,0x40,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,
- 0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x10,0x00,0x0C,0x00,0x00},/*"{",91*/
-{0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,
- 0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,
- 0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,
- 0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80},/*"|",92*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x08,0x00,0x04,0x00,0x04,0x00,0x04,0x00,
- 0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x02,0x00,
- 0x01,0x80,0x02,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,
- 0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x08,0x00,0x30,0x00,0x00,0x00},/*"}",93*/
-{0x00,0x00,0x1C,0x00,0x23,0x00,0x61,0x02,0x40,0x86,0x00,0x44,0x00,0x38,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00} /*"~",94*/
-};
-
-const unsigned char asc2_4824[95][144]={
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*" ",0*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,
- 0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,
- 0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,
- 0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,
- 0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x7C,0x00,0x00,
- 0x7C,0x00,0x00,0x7C,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"!",1*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x60,0x00,0xF0,0xF0,0x01,
- 0xF1,0xF0,0x01,0xE1,0xE0,0x03,0xC3,0xC0,0x03,0x83,0x80,0x07,0x07,0x00,0x06,0x06,
- 0x00,0x0C,0x0C,0x00,0x08,0x08,0x00,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*""",2*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x60,0x01,0x80,0x60,0x01,0x80,
- 0x60,0x01,0x80,0x60,0x01,0x80,0x60,0x01,0x80,0x60,0x01,0x80,0x60,0x3F,0xFF,0xFC,
- 0x3F,0xFF,0xFC,0x3F,0xFF,0xFC,0x3F,0xFF,0xFC,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,
- 0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,
- 0xC0,0x03,0x00,0xC0,0x3F,0xFF,0xFC,0x3F,0xFF,0xFC,0x3F,0xFF,0xFC,0x3F,0xFF,0xFC,
- 0x06,0x01,0x80,0x06,0x01,0x80,0x06,0x01,0x80,0x06,0x01,0x80,0x06,0x01,0x80,0x06,
- 0x01,0x80,0x06,0x01,0x80,0x06,0x01,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"#",3*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x7F,0x00,0x01,0xD9,0xC0,0x03,0x18,
- 0xE0,0x07,0x18,0x60,0x06,0x18,0x70,0x0E,0x18,0x70,0x0E,0x18,0xF0,0x0E,0x18,0xF0,
- 0x0F,0x18,0xE0,0x0F,0x18,0x00,0x07,0x98,0x00,0x07,0xD8,0x00,0x03,0xF8,0x00,0x01,
- 0xF8,0x00,0x00,0xFC,0x00,0x00,0x3F,0x00,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1B,
- 0xC0,0x00,0x19,0xE0,0x00,0x18,0xE0,0x00,0x18,0xF0,0x0E,0x18,0x70,0x1F,0x18,0x70,
- 0x1F,0x18,0x70,0x1F,0x18,0x70,0x1E,0x18,0x70,0x0C,0x18,0x60,0x0C,0x18,0xE0,0x06,
- 0x18,0xC0,0x03,0x1B,0x80,0x00,0xFE,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,
- 0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"$",4*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x30,0x18,0x80,0x20,0x30,0xC0,
- 0x60,0x20,0x40,0x40,0x60,0x60,0xC0,0x60,0x60,0x80,0x60,0x60,0x80,0x60,0x61,0x80,
- 0x60,0x61,0x00,0x60,0x63,0x00,0x60,0x62,0x00,0x60,0x66,0x00,0x60,0x64,0x00,0x30,
- 0x44,0x00,0x30,0xCC,0x00,0x19,0x88,0xF0,0x0F,0x19,0x98,0x00,0x13,0x0C,0x00,0x33,
- 0x0C,0x00,0x22,0x04,0x00,0x26,0x06,0x00,0x66,0x06,0x00,0x46,0x06,0x00,0xC6,0x06,
- 0x00,0x86,0x06,0x00,0x86,0x06,0x01,0x06,0x06,0x01,0x06,0x06,0x03,0x02,0x04,0x02,
- 0x03,0x0C,0x06,0x01,0x98,0x04,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"%",5*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x01,0x8E,0x00,0x03,0x06,
- 0x00,0x02,0x07,0x00,0x06,0x07,0x00,0x06,0x07,0x00,0x06,0x07,0x00,0x06,0x07,0x00,
- 0x06,0x07,0x00,0x06,0x0E,0x00,0x07,0x0E,0x00,0x03,0x1C,0x00,0x03,0xB8,0x00,0x03,
- 0xE0,0x00,0x03,0x83,0xFC,0x07,0xC0,0x70,0x0D,0xC0,0x60,0x19,0xE0,0x60,0x38,0xE0,
- 0x60,0x30,0xF0,0x60,0x30,0x70,0x40,0x70,0x78,0x40,0x70,0x38,0xC0,0x70,0x3C,0xC0,
- 0x70,0x1E,0x80,0x70,0x0F,0x80,0x78,0x0F,0x00,0x38,0x07,0x81,0x3C,0x07,0xC1,0x1E,
- 0x0D,0xE2,0x0F,0xF8,0xFE,0x03,0xE0,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"&",6*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x1F,0x00,0x00,0x1F,
- 0x80,0x00,0x1F,0x80,0x00,0x0F,0x80,0x00,0x03,0x80,0x00,0x03,0x80,0x00,0x03,0x00,
- 0x00,0x06,0x00,0x00,0x0E,0x00,0x00,0x1C,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"'",7*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x10,0x00,
- 0x00,0x30,0x00,0x00,0x60,0x00,0x00,0xC0,0x00,0x01,0xC0,0x00,0x01,0x80,0x00,0x03,
- 0x00,0x00,0x07,0x00,0x00,0x06,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x1C,0x00,
- 0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,
- 0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,
- 0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x18,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,
- 0x00,0x1C,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x06,0x00,0x00,0x07,0x00,0x00,
- 0x03,0x00,0x00,0x03,0x80,0x00,0x01,0x80,0x00,0x00,0xC0,0x00,0x00,0x60,0x00,0x00,
- 0x30,0x00,0x00,0x10,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"(",8*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x18,0x00,0x00,0x0C,
- 0x00,0x00,0x0E,0x00,0x00,0x06,0x00,0x00,0x03,0x00,0x00,0x01,0x80,0x00,0x01,0xC0,
- 0x00,0x00,0xC0,0x00,0x00,0xE0,0x00,0x00,0x60,0x00,0x00,0x70,0x00,0x00,0x30,0x00,
- 0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,
- 0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,
- 0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,
- 0x00,0x30,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0xE0,0x00,0x00,0xC0,0x00,0x01,
- 0xC0,0x00,0x01,0x80,0x00,0x03,0x00,0x00,0x07,0x00,0x00,0x0E,0x00,0x00,0x0C,0x00,
- 0x00,0x18,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*")",9*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,
- 0x00,0x1C,0x00,0x18,0x1C,0x0C,0x3C,0x1C,0x3E,0x3F,0x18,0x7E,0x1F,0x88,0xFC,0x07,
- 0xC9,0xF0,0x00,0xEB,0x80,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0xEB,0x80,0x07,0xC9,
- 0xF0,0x1F,0x88,0xFC,0x3F,0x0C,0x7E,0x3E,0x1C,0x1E,0x18,0x1C,0x0E,0x00,0x1C,0x00,
- 0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"*",10*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,
- 0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,
- 0x18,0x00,0x00,0x18,0x00,0x3F,0xFF,0xFC,0x3F,0xFF,0xFC,0x00,0x18,0x00,0x00,0x18,
- 0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,
- 0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"+",11*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x1F,0x00,0x00,0x1F,
- 0x80,0x00,0x1F,0x80,0x00,0x0F,0x80,0x00,0x03,0x80,0x00,0x03,0x80,0x00,0x03,0x00,
- 0x00,0x06,0x00,0x00,0x0E,0x00,0x00,0x1C,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00},/*",",12*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x3F,0xFF,0xFE,0x3F,0xFF,0xFE,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"-",13*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,
- 0x80,0x00,0x1F,0x80,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*".",14*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,
- 0x00,0x0C,0x00,0x00,0x08,0x00,0x00,0x18,0x00,0x00,0x10,0x00,0x00,0x30,0x00,0x00,
- 0x20,0x00,0x00,0x60,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x80,0x00,0x00,0x80,
- 0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x03,0x00,0x00,0x02,0x00,0x00,0x06,0x00,0x00,
- 0x04,0x00,0x00,0x0C,0x00,0x00,0x08,0x00,0x00,0x18,0x00,0x00,0x10,0x00,0x00,0x30,
- 0x00,0x00,0x20,0x00,0x00,0x60,0x00,0x00,0x40,0x00,0x00,0xC0,0x00,0x00,0x80,0x00,
- 0x00,0x80,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x06,
- 0x00,0x00,0x04,0x00,0x00,0x0C,0x00,0x00,0x08,0x00,0x00,0x18,0x00,0x00,0x10,0x00,
- 0x00,0x30,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"/",15*/
- {0x0,0x0,0x0,0x0,0x0,0x0,0x7f,0xff,0xfc,0xbf,0xff,0xfa,0xdf,0xff,0xf6,0xef,0xff,0xee,0xf7,0xff,0xde,0xfb,0xff,0xbe,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0x7c,0x0,0x7c,0xbc,0x0,0x7a,0xdc,0x0,0x76,0xec,0x0,0x6e,0xf4,0x0,0x5e,0xf8,0x0,0x3e,0xfc,0x0,0x7e,0xf8,0x0,0x3e,0xf4,0x0,0x5e,0xec,0x0,0x6e,0xdc,0x0,0x76,0xbc,0x0,0x7a,0x7c,0x0,0x7c,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfb,0xff,0xbe,0xf7,0xff,0xde,0xef,0xff,0xee,0xdf,0xff,0xf6,0xbf,0xff,0xfa,0x7f,0xff,0xfc,0x0,0x0,0x0},/*"0",16*/
- {0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7f,0xf8,0x0,0xbf,0xf8,0x0,0xdf,0xf0,0x0,0xef,0xe0,0x0,0xf7,0xc0,0x0,0xfb,0x80,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0x7c,0x0,0x0,0xbc,0x0,0x0,0xdc,0x0,0x0,0xec,0x0,0x0,0xf4,0x0,0x0,0xf8,0x0,0x0,0xf4,0x0,0x0,0xec,0x0,0x0,0xdc,0x0,0x0,0xbc,0x0,0x0,0x7c,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0x78,0x0,0xf,0xb7,0xc0,0x1f,0xcf,0xe0,0x3f,0xff,0xf0,0x7f,0xff,0xf8,0xff,0xff,0xfc,0xff,0xff,0xfc,0x0,0x0,0x0},/*"1",17*/
- {0x0,0x0,0x0,0x0,0x0,0x0,0x3f,0xff,0xfe,0xdf,0xff,0xf8,0xdf,0xff,0xf8,0xe7,0xff,0xf0,0xfb,0xff,0xc0,0xfb,0xff,0xc0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0x3c,0x0,0x0,0x1b,0xff,0x80,0x1b,0xff,0x80,0x7,0xff,0xc0,0x7,0xff,0xc0,0x7,0xff,0xc0,0x3,0xff,0xb0,0x0,0x0,0x78,0x0,0x0,0x78,0x0,0x0,0x7e,0x0,0x0,0x7e,0x0,0x0,0x7e,0x0,0x0,0x7e,0x0,0x0,0x7e,0x0,0x0,0x7e,0x0,0x0,0x7e,0x0,0x0,0x7e,0x0,0x0,0x7e,0x0,0x0,0x7e,0x0,0x0,0x7e,0x0,0x0,0x7e,0x7,0xff,0xbe,0x1f,0xff,0xce,0x1f,0xff,0xce,0x3f,0xff,0xf6,0xff,0xff,0xf8,0xff,0xff,0xf8,0x0,0x0,0x0},/*"2",18*/
- {0x0,0x0,0x0,0x0,0x0,0x0,0x3f,0xff,0xf8,0xff,0xff,0xf0,0xff,0xff,0xf0,0xff,0xff,0xc0,0xff,0xff,0x80,0xff,0xff,0x80,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0x3c,0x0,0x0,0xdc,0x0,0x0,0xdc,0x0,0x0,0xe7,0xff,0xc0,0xfb,0xff,0x80,0xfb,0xff,0x80,0xfb,0xfe,0x0,0xe4,0xfc,0x0,0xe4,0xfc,0x0,0xdc,0x0,0x0,0x3c,0x0,0x0,0x3c,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfb,0xff,0x80,0xe7,0xff,0xc0,0xe7,0xff,0xc0,0xdf,0xff,0xf0,0x3f,0xff,0xf8,0x3f,0xff,0xf8,0x0,0x0,0x0},/*"3",19*/
- {0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0,0x6,0xc0,0x0,0x6,0xe0,0x0,0xe,0xf8,0x0,0x3e,0xf8,0x0,0x3e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0x3c,0x0,0x78,0xdc,0x0,0x70,0xdc,0x0,0x70,0xe7,0xff,0xc0,0xfb,0xff,0x80,0xfb,0xff,0x80,0xfb,0xfe,0x0,0xe7,0xfc,0x0,0xe7,0xfc,0x0,0xdc,0x0,0x0,0x3c,0x0,0x0,0x3c,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xf8,0x0,0x0,0xe0,0x0,0x0,0xe0,0x0,0x0,0xc0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},/*"4",20*/
- {0x0,0x0,0x0,0x0,0x0,0x0,0xff,0xff,0xf8,0x3f,0xff,0xf6,0x3f,0xff,0xf6,0x1f,0xff,0xce,0x7,0xff,0xbe,0x7,0xff,0xbe,0x0,0x0,0x7e,0x0,0x0,0x7e,0x0,0x0,0x7e,0x0,0x0,0x7e,0x0,0x0,0x7e,0x0,0x0,0x7e,0x0,0x0,0x7e,0x0,0x0,0x7e,0x0,0x0,0x7e,0x0,0x0,0x7e,0x0,0x0,0x7e,0x0,0x0,0x7e,0x0,0x0,0x78,0x3,0xff,0xb0,0x3,0xff,0xb0,0x7,0xff,0xc0,0x7,0xff,0xc0,0x7,0xff,0xc0,0x1b,0xff,0x80,0x3c,0x0,0x0,0x3c,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfb,0xff,0xc0,0xe7,0xff,0xf0,0xe7,0xff,0xf0,0xdf,0xff,0xf8,0x3f,0xff,0xfe,0x3f,0xff,0xfe,0x0,0x0,0x0},/*"5",21*/
- {0x0,0x0,0x0,0x0,0x0,0x0,0xff,0xff,0xf8,0x3f,0xff,0xf6,0x3f,0xff,0xf6,0x1f,0xff,0xce,0x7,0xff,0xbe,0x7,0xff,0xbe,0x0,0x0,0x7e,0x0,0x0,0x7e,0x0,0x0,0x7e,0x0,0x0,0x7e,0x0,0x0,0x7e,0x0,0x0,0x7e,0x0,0x0,0x7e,0x0,0x0,0x7e,0x0,0x0,0x7e,0x0,0x0,0x78,0x0,0x0,0x76,0x0,0x0,0x76,0x0,0x0,0x4e,0x3,0xfe,0x3e,0x3,0xfe,0x3e,0x7,0xff,0xfe,0x1f,0xff,0xfe,0x1f,0xff,0xfe,0x3f,0xfe,0x3e,0xfc,0x0,0x4e,0xfc,0x0,0x4e,0xfc,0x0,0x76,0xfc,0x0,0x78,0xfc,0x0,0x78,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfb,0xff,0xbe,0xe7,0xff,0xce,0xe7,0xff,0xce,0xdf,0xff,0xf6,0x3f,0xff,0xf8,0x3f,0xff,0xf8,0x0,0x0,0x0},/*"6",22*/
- {0x0,0x0,0x0,0x0,0x0,0x0,0x3f,0xff,0xfe,0xdf,0xff,0xf8,0xdf,0xff,0xf8,0xe7,0xff,0xf0,0xfb,0xff,0xc0,0xfb,0xff,0xc0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0x3c,0x0,0x0,0xdc,0x0,0x0,0xdc,0x0,0x0,0xe4,0x0,0x0,0xf8,0x0,0x0,0xf8,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xf8,0x0,0x0,0xe4,0x0,0x0,0xe4,0x0,0x0,0xdc,0x0,0x0,0x3c,0x0,0x0,0x3c,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xf8,0x0,0x0,0xf8,0x0,0x0,0xe0,0x0,0x0,0xc0,0x0,0x0,0xc0,0x0,0x0,0x0,0x0,0x0},/*"7",23*/
- {0x0,0x0,0x0,0x0,0x0,0x0,0x3f,0xff,0xf8,0xdf,0xff,0xf6,0xdf,0xff,0xf6,0xe7,0xff,0xce,0xfb,0xff,0xbe,0xfb,0xff,0xbe,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0x3c,0x0,0x78,0xdc,0x0,0x76,0xdc,0x0,0x76,0xe4,0xfe,0x4e,0xfb,0xff,0xbe,0xfb,0xff,0xbe,0xfb,0xff,0xbe,0xe4,0xfe,0x4e,0xe4,0xfe,0x4e,0xdc,0x0,0x76,0x3c,0x0,0x78,0x3c,0x0,0x78,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfb,0xff,0xbe,0xe7,0xff,0xce,0xe7,0xff,0xce,0xdf,0xff,0xf6,0x3f,0xff,0xf8,0x3f,0xff,0xf8,0x0,0x0,0x0},/*"8",24*/
- {0x0,0x0,0x0,0x0,0x0,0x0,0x3f,0xff,0xf8,0xdf,0xff,0xf6,0xdf,0xff,0xf6,0xe7,0xff,0xce,0xfb,0xff,0xbe,0xfb,0xff,0xbe,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0xfc,0x0,0x7e,0x3c,0x0,0x7e,0xdc,0x0,0x7e,0xdc,0x0,0x7e,0xe4,0x0,0x7e,0xf8,0xff,0xf8,0xf8,0xff,0xf8,0xff,0xff,0xf0,0xff,0xff,0xc0,0xff,0xff,0xc0,0xf8,0xff,0x80,0xe4,0x0,0x0,0xe4,0x0,0x0,0xdc,0x0,0x0,0x3c,0x0,0x0,0x3c,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfc,0x0,0x0,0xfb,0xff,0xc0,0xe7,0xff,0xf0,0xe7,0xff,0xf0,0xdf,0xff,0xf8,0x3f,0xff,0xfe,0x3f,0xff,0xfe,0x0,0x0,0x0},/*"9",25*/
- {0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xff,0x80,0x0,0xff,0x80,0x0,0xff,0x80,0x0,0xff,0x80,0x0,0xff,0x80,0x0,0xff,0x80,0x0,0xff,0x80,0x0,0xff,0x80,0x0,0xff,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xff,0x80,0x0,0xff,0x80,0x0,0xff,0x80,0x0,0xff,0x80,0x0,0xff,0x80,0x0,0xff,0x80,0x0,0xff,0x80,0x0,0xff,0x80,0x0,0xff,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},/*":",26*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,
- 0x3C,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,
- 0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x0C,0x00,0x00,0x18,0x00,0x00,0x18,
- 0x00,0x00,0x18,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*";",27*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x38,0x00,0x00,0x70,0x00,0x00,
- 0xE0,0x00,0x01,0x80,0x00,0x03,0x00,0x00,0x06,0x00,0x00,0x0C,0x00,0x00,0x18,0x00,
- 0x00,0x30,0x00,0x00,0x60,0x00,0x00,0xC0,0x00,0x01,0x80,0x00,0x03,0x00,0x00,0x06,
- 0x00,0x00,0x0C,0x00,0x00,0x18,0x00,0x00,0x0C,0x00,0x00,0x06,0x00,0x00,0x03,0x00,
- 0x00,0x01,0x80,0x00,0x00,0xC0,0x00,0x00,0x60,0x00,0x00,0x30,0x00,0x00,0x18,0x00,
- 0x00,0x0C,0x00,0x00,0x06,0x00,0x00,0x03,0x00,0x00,0x01,0x80,0x00,0x00,0xE0,0x00,
- 0x00,0x70,0x00,0x00,0x38,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"<",28*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xFF,0xFE,0x3F,0xFF,0xFE,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x3F,0xFF,0xFE,0x3F,0xFF,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"=",29*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x1C,0x00,0x00,0x0E,0x00,0x00,0x07,0x00,
- 0x00,0x01,0x80,0x00,0x00,0xC0,0x00,0x00,0x60,0x00,0x00,0x30,0x00,0x00,0x18,0x00,
- 0x00,0x0C,0x00,0x00,0x06,0x00,0x00,0x03,0x00,0x00,0x01,0x80,0x00,0x00,0xC0,0x00,
- 0x00,0x60,0x00,0x00,0x30,0x00,0x00,0x18,0x00,0x00,0x30,0x00,0x00,0x60,0x00,0x00,
- 0xC0,0x00,0x01,0x80,0x00,0x03,0x00,0x00,0x06,0x00,0x00,0x0C,0x00,0x00,0x18,0x00,
- 0x00,0x30,0x00,0x00,0x60,0x00,0x00,0xC0,0x00,0x01,0x80,0x00,0x07,0x00,0x00,0x0E,
- 0x00,0x00,0x1C,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*">",30*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x03,0xFF,0x80,0x07,0x01,0xC0,0x0C,0x00,
- 0xE0,0x18,0x00,0x70,0x18,0x00,0x30,0x30,0x00,0x38,0x38,0x00,0x38,0x3C,0x00,0x38,
- 0x3E,0x00,0x38,0x3E,0x00,0x38,0x1E,0x00,0x38,0x00,0x00,0x70,0x00,0x00,0xF0,0x00,
- 0x01,0xE0,0x00,0x03,0xC0,0x00,0x07,0x80,0x00,0x0E,0x00,0x00,0x1C,0x00,0x00,0x18,
- 0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x7C,0x00,0x00,
- 0x7C,0x00,0x00,0x7C,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"?",31*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0xE0,0xC0,0x01,0x80,
- 0x30,0x03,0x00,0x10,0x06,0x00,0x18,0x06,0x00,0x0C,0x0C,0x07,0x6C,0x0C,0x18,0xCC,
- 0x1C,0x30,0xC6,0x1C,0x30,0xC6,0x18,0x60,0xC6,0x38,0x60,0xC6,0x38,0xC0,0xC6,0x38,
- 0xC1,0xC6,0x38,0xC1,0xC6,0x39,0x81,0xC6,0x39,0x81,0xC6,0x39,0x81,0x86,0x39,0x81,
- 0x84,0x39,0x83,0x8C,0x39,0x83,0x8C,0x19,0x87,0x88,0x1C,0xCD,0x98,0x1C,0xFD,0xF0,
- 0x1C,0x70,0xE6,0x0E,0x00,0x04,0x0E,0x00,0x0C,0x07,0x00,0x18,0x03,0x80,0x30,0x01,
- 0xE0,0xF0,0x00,0xFF,0xC0,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"@",32*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x38,0x00,0x00,0x3C,0x00,0x00,0x7C,
- 0x00,0x00,0x7C,0x00,0x00,0x7C,0x00,0x00,0x6C,0x00,0x00,0xCE,0x00,0x00,0xCE,0x00,
- 0x00,0xCE,0x00,0x00,0xC6,0x00,0x01,0x87,0x00,0x01,0x87,0x00,0x01,0x87,0x00,0x01,
- 0x83,0x00,0x03,0x03,0x80,0x03,0x03,0x80,0x03,0x03,0x80,0x03,0x03,0x80,0x06,0x01,
- 0xC0,0x07,0xFF,0xC0,0x06,0x01,0xC0,0x06,0x01,0xC0,0x0C,0x01,0xE0,0x0C,0x00,0xE0,
- 0x0C,0x00,0xE0,0x0C,0x00,0xE0,0x18,0x00,0xF0,0x18,0x00,0x70,0x18,0x00,0x70,0x18,
- 0x00,0x70,0x38,0x00,0x78,0xFE,0x01,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"A",33*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFF,0x00,0x0E,0x03,0xC0,0x0E,0x01,
- 0xE0,0x0E,0x00,0xE0,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,
- 0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0xE0,0x0E,0x00,0xE0,0x0E,0x01,0xC0,0x0E,
- 0x03,0x80,0x0F,0xFE,0x00,0x0E,0x01,0xC0,0x0E,0x00,0x60,0x0E,0x00,0x70,0x0E,0x00,
- 0x38,0x0E,0x00,0x38,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,
- 0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x38,0x0E,0x00,0x38,0x0E,
- 0x00,0x70,0x0E,0x01,0xC0,0x7F,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"B",34*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x84,0x00,0x60,0xFC,0x01,0x80,
- 0x3C,0x03,0x00,0x1C,0x07,0x00,0x0C,0x06,0x00,0x0C,0x0E,0x00,0x06,0x0C,0x00,0x06,
- 0x1C,0x00,0x02,0x1C,0x00,0x00,0x18,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,
- 0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,
- 0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x1C,0x00,0x02,0x1C,0x00,0x06,
- 0x1C,0x00,0x04,0x0E,0x00,0x04,0x0E,0x00,0x0C,0x07,0x00,0x18,0x07,0x80,0x30,0x03,
- 0xC0,0xE0,0x00,0xFF,0xC0,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"C",35*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xF8,0x00,0x0E,0x07,0x00,0x0E,0x01,
- 0x80,0x0E,0x00,0xC0,0x0E,0x00,0x60,0x0E,0x00,0x70,0x0E,0x00,0x30,0x0E,0x00,0x38,
- 0x0E,0x00,0x38,0x0E,0x00,0x18,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,
- 0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,
- 0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x18,0x0E,0x00,0x38,0x0E,0x00,0x38,
- 0x0E,0x00,0x38,0x0E,0x00,0x30,0x0E,0x00,0x70,0x0E,0x00,0xE0,0x0E,0x00,0xC0,0x0E,
- 0x03,0x80,0x0E,0x0F,0x00,0x7F,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"D",36*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFF,0xE0,0x0E,0x00,0xE0,0x0E,0x00,
- 0x70,0x0E,0x00,0x30,0x0E,0x00,0x10,0x0E,0x00,0x18,0x0E,0x00,0x08,0x0E,0x00,0x00,
- 0x0E,0x00,0x00,0x0E,0x00,0x80,0x0E,0x00,0x80,0x0E,0x00,0x80,0x0E,0x00,0x80,0x0E,
- 0x01,0x80,0x0F,0xFF,0x80,0x0E,0x03,0x80,0x0E,0x01,0x80,0x0E,0x00,0x80,0x0E,0x00,
- 0x80,0x0E,0x00,0x80,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,
- 0x0E,0x00,0x04,0x0E,0x00,0x04,0x0E,0x00,0x08,0x0E,0x00,0x08,0x0E,0x00,0x18,0x0E,
- 0x00,0x38,0x0E,0x00,0xF0,0x7F,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"E",37*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFF,0xF8,0x0E,0x00,0x78,0x0E,0x00,
- 0x3C,0x0E,0x00,0x0C,0x0E,0x00,0x04,0x0E,0x00,0x06,0x0E,0x00,0x02,0x0E,0x00,0x00,
- 0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x40,0x0E,0x00,0x40,0x0E,0x00,0x40,0x0E,
- 0x00,0x40,0x0E,0x00,0xC0,0x0F,0xFF,0xC0,0x0E,0x01,0xC0,0x0E,0x00,0xC0,0x0E,0x00,
- 0x40,0x0E,0x00,0x40,0x0E,0x00,0x40,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,
- 0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,
- 0x00,0x00,0x0E,0x00,0x00,0x7F,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"F",38*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x20,0x01,0xC3,0xE0,0x03,0x00,
- 0xE0,0x06,0x00,0xE0,0x0E,0x00,0x60,0x0C,0x00,0x20,0x1C,0x00,0x30,0x18,0x00,0x30,
- 0x38,0x00,0x10,0x38,0x00,0x00,0x30,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,
- 0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x03,
- 0xFE,0x70,0x00,0xF8,0x70,0x00,0x70,0x30,0x00,0x70,0x38,0x00,0x70,0x38,0x00,0x70,
- 0x38,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x0C,0x00,0x70,0x06,0x00,0x70,0x07,
- 0x00,0xF0,0x01,0xC1,0x80,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"G",39*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x83,0xFE,0x1C,0x00,0x70,0x1C,0x00,
- 0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,
- 0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,
- 0x00,0x70,0x1C,0x00,0x70,0x1F,0xFF,0xF0,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,
- 0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,
- 0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,
- 0x00,0x70,0x1C,0x00,0x70,0xFF,0x83,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"H",40*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xF0,0x00,0x1C,0x00,0x00,0x1C,
- 0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,
- 0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,
- 0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,
- 0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,
- 0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,
- 0x1C,0x00,0x00,0x1C,0x00,0x07,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"I",41*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFE,0x00,0x03,0x80,0x00,0x03,
- 0x80,0x00,0x03,0x80,0x00,0x03,0x80,0x00,0x03,0x80,0x00,0x03,0x80,0x00,0x03,0x80,
- 0x00,0x03,0x80,0x00,0x03,0x80,0x00,0x03,0x80,0x00,0x03,0x80,0x00,0x03,0x80,0x00,
- 0x03,0x80,0x00,0x03,0x80,0x00,0x03,0x80,0x00,0x03,0x80,0x00,0x03,0x80,0x00,0x03,
- 0x80,0x00,0x03,0x80,0x00,0x03,0x80,0x00,0x03,0x80,0x00,0x03,0x80,0x00,0x03,0x80,
- 0x00,0x03,0x80,0x00,0x03,0x80,0x00,0x03,0x80,0x00,0x03,0x80,0x00,0x03,0x80,0x00,
- 0x03,0x80,0x00,0x03,0x80,0x00,0x03,0x80,0x18,0x03,0x00,0x3C,0x03,0x00,0x3C,0x06,
- 0x00,0x3C,0x0E,0x00,0x1C,0x18,0x00,0x07,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"J",42*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xC7,0xFC,0x0E,0x00,0xF0,0x0E,0x00,
- 0xE0,0x0E,0x01,0xC0,0x0E,0x01,0x80,0x0E,0x03,0x00,0x0E,0x07,0x00,0x0E,0x0E,0x00,
- 0x0E,0x0C,0x00,0x0E,0x18,0x00,0x0E,0x38,0x00,0x0E,0x30,0x00,0x0E,0x70,0x00,0x0E,
- 0xF8,0x00,0x0E,0xF8,0x00,0x0F,0xBC,0x00,0x0F,0x9C,0x00,0x0F,0x1E,0x00,0x0E,0x0E,
- 0x00,0x0E,0x0F,0x00,0x0E,0x07,0x00,0x0E,0x07,0x00,0x0E,0x03,0x80,0x0E,0x03,0x80,
- 0x0E,0x01,0xC0,0x0E,0x01,0xC0,0x0E,0x01,0xE0,0x0E,0x00,0xE0,0x0E,0x00,0xF0,0x0E,
- 0x00,0x70,0x0E,0x00,0x78,0x7F,0xC1,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"K",43*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xE0,0x00,0x07,0x00,0x00,0x07,0x00,
- 0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,
- 0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,
- 0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,
- 0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,
- 0x07,0x00,0x02,0x07,0x00,0x02,0x07,0x00,0x06,0x07,0x00,0x04,0x07,0x00,0x0C,0x07,
- 0x00,0x1C,0x07,0x00,0x7C,0x3F,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"L",44*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0x7F,0x1E,0x00,0xF8,0x1E,0x00,
- 0xF8,0x1E,0x00,0xF8,0x1E,0x00,0xF8,0x1E,0x00,0xB8,0x17,0x01,0xB8,0x17,0x01,0xB8,
- 0x17,0x01,0xB8,0x17,0x01,0xB8,0x17,0x83,0x38,0x13,0x83,0x38,0x13,0x83,0x38,0x13,
- 0x83,0x38,0x13,0x82,0x38,0x11,0xC6,0x38,0x11,0xC6,0x38,0x11,0xC6,0x38,0x11,0xC4,
- 0x38,0x11,0xE4,0x38,0x10,0xEC,0x38,0x10,0xEC,0x38,0x10,0xE8,0x38,0x10,0xF8,0x38,
- 0x10,0x78,0x38,0x10,0x78,0x38,0x10,0x78,0x38,0x10,0x70,0x38,0x10,0x70,0x38,0x10,
- 0x30,0x38,0x10,0x30,0x38,0xFE,0x21,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"M",45*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x7F,0x0E,0x00,0x08,0x0F,0x00,
- 0x08,0x0F,0x80,0x08,0x0B,0x80,0x08,0x0B,0xC0,0x08,0x09,0xC0,0x08,0x09,0xE0,0x08,
- 0x08,0xE0,0x08,0x08,0xF0,0x08,0x08,0x70,0x08,0x08,0x78,0x08,0x08,0x38,0x08,0x08,
- 0x3C,0x08,0x08,0x1C,0x08,0x08,0x1E,0x08,0x08,0x0E,0x08,0x08,0x0F,0x08,0x08,0x07,
- 0x08,0x08,0x03,0x88,0x08,0x03,0x88,0x08,0x01,0xC8,0x08,0x01,0xE8,0x08,0x00,0xE8,
- 0x08,0x00,0xF8,0x08,0x00,0x78,0x08,0x00,0x78,0x08,0x00,0x38,0x08,0x00,0x38,0x08,
- 0x00,0x18,0x08,0x00,0x18,0x7F,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"N",46*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0xC1,0x80,0x03,0x80,
- 0x60,0x03,0x00,0x60,0x06,0x00,0x30,0x0E,0x00,0x38,0x0C,0x00,0x18,0x1C,0x00,0x1C,
- 0x1C,0x00,0x1C,0x18,0x00,0x0C,0x38,0x00,0x0C,0x38,0x00,0x0E,0x38,0x00,0x0E,0x38,
- 0x00,0x0E,0x38,0x00,0x0E,0x38,0x00,0x0E,0x38,0x00,0x0E,0x38,0x00,0x0E,0x38,0x00,
- 0x0E,0x38,0x00,0x0E,0x38,0x00,0x0E,0x18,0x00,0x0C,0x18,0x00,0x0C,0x1C,0x00,0x1C,
- 0x1C,0x00,0x1C,0x0C,0x00,0x18,0x0E,0x00,0x18,0x06,0x00,0x30,0x03,0x00,0x60,0x01,
- 0x80,0xC0,0x00,0xC1,0x80,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"O",47*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFF,0x00,0x0E,0x01,0xC0,0x0E,0x00,
- 0x70,0x0E,0x00,0x38,0x0E,0x00,0x38,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,
- 0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x38,0x0E,
- 0x00,0x30,0x0E,0x00,0x70,0x0E,0x01,0xC0,0x0F,0xFF,0x00,0x0E,0x00,0x00,0x0E,0x00,
- 0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,
- 0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,
- 0x00,0x00,0x0E,0x00,0x00,0x7F,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"P",48*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x01,0xC1,0x80,0x03,0x80,
- 0x60,0x07,0x00,0x30,0x06,0x00,0x30,0x0E,0x00,0x18,0x0C,0x00,0x18,0x1C,0x00,0x1C,
- 0x1C,0x00,0x1C,0x18,0x00,0x0C,0x38,0x00,0x0E,0x38,0x00,0x0E,0x38,0x00,0x0E,0x38,
- 0x00,0x0E,0x38,0x00,0x0E,0x38,0x00,0x0E,0x38,0x00,0x0E,0x38,0x00,0x0E,0x38,0x00,
- 0x0E,0x38,0x00,0x0E,0x38,0x00,0x0E,0x38,0x00,0x0E,0x1C,0x78,0x0C,0x1C,0xFE,0x1C,
- 0x1D,0x8E,0x1C,0x1F,0x07,0x18,0x0F,0x07,0x38,0x07,0x03,0xB0,0x07,0x03,0xF0,0x03,
- 0x83,0xE0,0x00,0xC3,0xC0,0x00,0x3F,0xC4,0x00,0x01,0xC4,0x00,0x01,0xF8,0x00,0x00,
- 0xF8,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"Q",49*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFF,0x00,0x0E,0x03,0xC0,0x0E,0x00,
- 0xE0,0x0E,0x00,0x70,0x0E,0x00,0x78,0x0E,0x00,0x38,0x0E,0x00,0x38,0x0E,0x00,0x38,
- 0x0E,0x00,0x38,0x0E,0x00,0x38,0x0E,0x00,0x38,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,
- 0x00,0xE0,0x0E,0x03,0xC0,0x0F,0xFF,0x00,0x0E,0x1E,0x00,0x0E,0x0E,0x00,0x0E,0x0E,
- 0x00,0x0E,0x0F,0x00,0x0E,0x07,0x00,0x0E,0x07,0x80,0x0E,0x03,0x80,0x0E,0x03,0x80,
- 0x0E,0x01,0xC0,0x0E,0x01,0xC0,0x0E,0x01,0xE0,0x0E,0x00,0xE0,0x0E,0x00,0xE0,0x0E,
- 0x00,0x70,0x0E,0x00,0x78,0x7F,0xC0,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"R",50*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x10,0x03,0x03,0xF0,0x0E,0x00,
- 0xF0,0x0C,0x00,0x70,0x1C,0x00,0x70,0x38,0x00,0x30,0x38,0x00,0x30,0x38,0x00,0x10,
- 0x38,0x00,0x00,0x38,0x00,0x00,0x3C,0x00,0x00,0x1E,0x00,0x00,0x0F,0x80,0x00,0x07,
- 0xE0,0x00,0x03,0xF8,0x00,0x00,0xFE,0x00,0x00,0x3F,0x80,0x00,0x07,0xC0,0x00,0x03,
- 0xE0,0x00,0x00,0xF0,0x00,0x00,0x70,0x00,0x00,0x78,0x20,0x00,0x38,0x30,0x00,0x38,
- 0x30,0x00,0x38,0x30,0x00,0x38,0x18,0x00,0x38,0x18,0x00,0x70,0x1C,0x00,0x60,0x1E,
- 0x00,0xE0,0x1F,0x81,0x80,0x10,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"S",51*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xFF,0xF8,0x38,0x38,0x38,0x30,0x38,
- 0x18,0x30,0x38,0x08,0x20,0x38,0x08,0x60,0x38,0x0C,0x40,0x38,0x04,0x00,0x38,0x00,
- 0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,
- 0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,
- 0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,
- 0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,
- 0x38,0x00,0x00,0x38,0x00,0x01,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"T",52*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x80,0xFE,0x1C,0x00,0x10,0x1C,0x00,
- 0x10,0x1C,0x00,0x10,0x1C,0x00,0x10,0x1C,0x00,0x10,0x1C,0x00,0x10,0x1C,0x00,0x10,
- 0x1C,0x00,0x10,0x1C,0x00,0x10,0x1C,0x00,0x10,0x1C,0x00,0x10,0x1C,0x00,0x10,0x1C,
- 0x00,0x10,0x1C,0x00,0x10,0x1C,0x00,0x10,0x1C,0x00,0x10,0x1C,0x00,0x10,0x1C,0x00,
- 0x10,0x1C,0x00,0x10,0x1C,0x00,0x10,0x1C,0x00,0x10,0x1C,0x00,0x10,0x1C,0x00,0x10,
- 0x1C,0x00,0x10,0x1C,0x00,0x10,0x1C,0x00,0x30,0x0E,0x00,0x20,0x0E,0x00,0x60,0x07,
- 0x81,0xC0,0x03,0xFF,0x80,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"U",53*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x80,0x7F,0x1E,0x00,0x3C,0x0E,0x00,
- 0x18,0x0E,0x00,0x18,0x0E,0x00,0x30,0x07,0x00,0x30,0x07,0x00,0x30,0x07,0x00,0x30,
- 0x07,0x80,0x60,0x03,0x80,0x60,0x03,0x80,0x60,0x03,0x80,0x60,0x01,0xC0,0xC0,0x01,
- 0xC0,0xC0,0x01,0xC0,0xC0,0x01,0xE0,0x80,0x00,0xE1,0x80,0x00,0xE1,0x80,0x00,0xE1,
- 0x80,0x00,0x71,0x00,0x00,0x73,0x00,0x00,0x73,0x00,0x00,0x73,0x00,0x00,0x3A,0x00,
- 0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x3C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,
- 0x1C,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"V",54*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x7F,0x7E,0x38,0x3C,0x18,0x38,0x1C,
- 0x18,0x38,0x1C,0x18,0x38,0x1C,0x18,0x38,0x1C,0x30,0x38,0x1C,0x30,0x3C,0x0E,0x30,
- 0x1C,0x0E,0x30,0x1C,0x1E,0x30,0x1C,0x1E,0x30,0x1C,0x1E,0x20,0x1C,0x1E,0x60,0x1C,
- 0x3E,0x60,0x1E,0x37,0x60,0x0E,0x27,0x60,0x0E,0x67,0x60,0x0E,0x67,0x40,0x0E,0x47,
- 0x40,0x0E,0x47,0x40,0x0E,0xC7,0xC0,0x0F,0xC3,0xC0,0x07,0x83,0xC0,0x07,0x83,0x80,
- 0x07,0x83,0x80,0x07,0x83,0x80,0x07,0x03,0x80,0x07,0x03,0x80,0x07,0x01,0x80,0x03,
- 0x01,0x00,0x02,0x01,0x00,0x02,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"W",55*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xC1,0xFC,0x0F,0x00,0x70,0x07,0x00,
- 0x60,0x07,0x00,0x40,0x03,0x80,0xC0,0x03,0x80,0x80,0x03,0xC1,0x80,0x01,0xC1,0x00,
- 0x01,0xE3,0x00,0x00,0xE2,0x00,0x00,0xF6,0x00,0x00,0x76,0x00,0x00,0x7C,0x00,0x00,
- 0x3C,0x00,0x00,0x38,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x3E,0x00,0x00,0x2E,
- 0x00,0x00,0x6F,0x00,0x00,0x47,0x00,0x00,0xC7,0x00,0x00,0x83,0x80,0x01,0x83,0x80,
- 0x01,0x01,0xC0,0x03,0x01,0xC0,0x02,0x01,0xE0,0x06,0x00,0xE0,0x04,0x00,0xF0,0x0C,
- 0x00,0x70,0x1C,0x00,0x78,0x7F,0x01,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"X",56*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x83,0xFC,0x1E,0x00,0xF0,0x1E,0x00,
- 0x60,0x0E,0x00,0xE0,0x0E,0x00,0xC0,0x07,0x00,0xC0,0x07,0x01,0x80,0x07,0x81,0x80,
- 0x03,0x81,0x80,0x03,0x83,0x00,0x01,0xC3,0x00,0x01,0xC7,0x00,0x01,0xE6,0x00,0x00,
- 0xE6,0x00,0x00,0xEE,0x00,0x00,0xFC,0x00,0x00,0x7C,0x00,0x00,0x78,0x00,0x00,0x38,
- 0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,
- 0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,
- 0x38,0x00,0x00,0x38,0x00,0x01,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"Y",57*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xFC,0x07,0x80,0x38,0x0E,0x00,
- 0x78,0x0C,0x00,0x70,0x0C,0x00,0xF0,0x18,0x00,0xE0,0x10,0x01,0xE0,0x00,0x01,0xC0,
- 0x00,0x03,0xC0,0x00,0x03,0x80,0x00,0x07,0x80,0x00,0x07,0x00,0x00,0x0F,0x00,0x00,
- 0x0E,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x70,
- 0x00,0x00,0x70,0x00,0x00,0xE0,0x00,0x01,0xE0,0x00,0x01,0xC0,0x00,0x03,0xC0,0x00,
- 0x03,0x80,0x04,0x07,0x80,0x0C,0x07,0x00,0x08,0x0F,0x00,0x18,0x0E,0x00,0x18,0x1E,
- 0x00,0x38,0x1C,0x00,0xF0,0x3F,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"Z",58*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xF0,0x00,0x7F,0xF0,0x00,
- 0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,
- 0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,
- 0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,
- 0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,
- 0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,
- 0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,
- 0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,
- 0x00,0x00,0x7F,0xF0,0x00,0x7F,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"[",59*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x07,0x00,
- 0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0xC0,0x00,
- 0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x70,0x00,0x00,
- 0x30,0x00,0x00,0x30,0x00,0x00,0x38,0x00,0x00,0x18,0x00,0x00,0x1C,0x00,0x00,0x0C,
- 0x00,0x00,0x0C,0x00,0x00,0x0E,0x00,0x00,0x06,0x00,0x00,0x07,0x00,0x00,0x03,0x00,
- 0x00,0x03,0x00,0x00,0x03,0x80,0x00,0x01,0x80,0x00,0x01,0xC0,0x00,0x00,0xC0,0x00,
- 0x00,0xC0,0x00,0x00,0xE0,0x00,0x00,0x60,0x00,0x00,0x70,0x00,0x00,0x30,0x00,0x00,
- 0x30,0x00,0x00,0x38,0x00,0x00,0x18,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x00},/*"\",60*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xFC,0x00,0x1F,0xFC,0x00,0x00,
- 0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,
- 0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,
- 0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,
- 0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,
- 0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,
- 0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,
- 0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,
- 0x00,0x1F,0xFC,0x00,0x1F,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"]",61*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x7F,0x00,0x00,
- 0xF7,0x80,0x00,0xC1,0x80,0x01,0x80,0xC0,0x02,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"^",62*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF},/*"_",63*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xC0,0x00,0x03,0xE0,0x00,0x00,
- 0xF0,0x00,0x00,0x38,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"`",64*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x03,0x03,0x80,0x0E,
- 0x01,0xC0,0x1C,0x00,0xE0,0x1C,0x00,0xE0,0x1C,0x00,0xE0,0x1C,0x00,0xE0,0x00,0x00,
- 0xE0,0x00,0x0F,0xE0,0x00,0xF8,0xE0,0x07,0x80,0xE0,0x0E,0x00,0xE0,0x1C,0x00,0xE0,
- 0x1C,0x00,0xE0,0x38,0x00,0xE0,0x38,0x00,0xE0,0x38,0x00,0xE2,0x38,0x00,0xE2,0x1C,
- 0x03,0xE6,0x0E,0x0C,0xFC,0x03,0xF0,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"a",65*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x02,0x00,0x00,0x06,0x00,0x00,0x7E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,
- 0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,
- 0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x1F,0x00,0x0E,0x7F,0xC0,0x0E,
- 0xE1,0xE0,0x0F,0x80,0xF0,0x0F,0x80,0x70,0x0F,0x00,0x70,0x0E,0x00,0x38,0x0E,0x00,
- 0x38,0x0E,0x00,0x38,0x0E,0x00,0x38,0x0E,0x00,0x38,0x0E,0x00,0x38,0x0E,0x00,0x38,
- 0x0E,0x00,0x38,0x0E,0x00,0x38,0x0E,0x00,0x30,0x0E,0x00,0x70,0x0F,0x00,0x60,0x0F,
- 0x00,0xC0,0x0D,0xC1,0x80,0x08,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"b",66*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0xC1,0xC0,0x03,
- 0x80,0xE0,0x07,0x00,0x70,0x06,0x00,0xF0,0x0E,0x00,0xF0,0x0E,0x00,0xF0,0x1C,0x00,
- 0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,
- 0x1C,0x00,0x00,0x0E,0x00,0x08,0x0E,0x00,0x18,0x0F,0x00,0x10,0x07,0x00,0x30,0x03,
- 0xC0,0xE0,0x01,0xFF,0xC0,0x00,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"c",67*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x30,0x00,0x03,0xF0,0x00,0x00,0x70,0x00,0x00,
- 0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,
- 0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x7C,0x70,0x01,0xC3,0x70,0x03,
- 0x00,0xF0,0x07,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0C,0x00,0x70,0x1C,0x00,
- 0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,
- 0x1C,0x00,0x70,0x1C,0x00,0x70,0x0E,0x00,0xF0,0x0E,0x00,0xF0,0x07,0x01,0xF0,0x03,
- 0x83,0x70,0x01,0xFE,0x7E,0x00,0xFC,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"d",68*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x01,0xC1,0x80,0x03,
- 0x00,0xE0,0x06,0x00,0x70,0x06,0x00,0x70,0x0C,0x00,0x30,0x0C,0x00,0x38,0x1C,0x00,
- 0x38,0x1C,0x00,0x38,0x1F,0xFF,0xF8,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,
- 0x1C,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x10,0x0F,0x00,0x30,0x07,0x00,0x60,0x03,
- 0xC0,0xC0,0x01,0xFF,0x80,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"e",69*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xE0,0x00,0x18,0x38,0x00,0x30,
- 0x3C,0x00,0x70,0x3C,0x00,0x60,0x3C,0x00,0xE0,0x38,0x00,0xE0,0x00,0x00,0xE0,0x00,
- 0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x3F,0xFF,0xE0,0x00,0xE0,0x00,0x00,
- 0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,
- 0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,
- 0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,
- 0xE0,0x00,0x00,0xE0,0x00,0x1F,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"f",70*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x1C,0x01,0x83,0xFE,0x03,
- 0x01,0xCE,0x07,0x01,0xC6,0x06,0x00,0xE0,0x0E,0x00,0xE0,0x0E,0x00,0xE0,0x0E,0x00,
- 0xE0,0x0E,0x00,0xE0,0x0E,0x00,0xE0,0x07,0x01,0xC0,0x03,0x01,0x80,0x01,0x83,0x80,
- 0x06,0x7E,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0F,0xC0,0x00,0x07,0xFF,0x00,0x03,
- 0xFF,0xE0,0x06,0x0F,0xF0,0x0C,0x00,0x78,0x1C,0x00,0x38,0x1C,0x00,0x38,0x1C,0x00,
- 0x38,0x1C,0x00,0x30,0x0E,0x00,0x70,0x07,0x81,0xE0,0x00,0xFF,0x00,0x00,0x00,0x00},/*"g",71*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x02,0x00,0x00,0x06,0x00,0x00,0x7E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,
- 0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,
- 0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x1F,0x80,0x0E,0x7F,0xC0,0x0E,
- 0xE1,0xE0,0x0F,0x80,0xF0,0x0F,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,
- 0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,
- 0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,
- 0x00,0x70,0x0E,0x00,0x70,0x7F,0xC3,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"h",72*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x3E,0x00,0x00,0x3E,
- 0x00,0x00,0x3E,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x00,0x07,0xFC,0x00,0x00,0x1C,0x00,0x00,
- 0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,
- 0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,
- 0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,
- 0x1C,0x00,0x00,0x1C,0x00,0x07,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"i",73*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x01,0xF0,0x00,0x01,
- 0xF0,0x00,0x01,0xF0,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x1F,0xE0,0x00,0x00,0xE0,0x00,
- 0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,
- 0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,
- 0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,
- 0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x06,0x01,
- 0xC0,0x0F,0x01,0xC0,0x0F,0x87,0x80,0x07,0xFE,0x00,0x03,0xF8,0x00,0x00,0x00,0x00},/*"j",74*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x02,0x00,0x00,0x06,0x00,0x00,0x7E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,
- 0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,
- 0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x07,0xF8,0x0E,0x07,0xF8,0x0E,
- 0x01,0x80,0x0E,0x03,0x00,0x0E,0x06,0x00,0x0E,0x0E,0x00,0x0E,0x1C,0x00,0x0E,0x38,
- 0x00,0x0E,0x78,0x00,0x0E,0x7C,0x00,0x0E,0xFC,0x00,0x0F,0xCE,0x00,0x0F,0x8F,0x00,
- 0x0F,0x07,0x00,0x0E,0x07,0x80,0x0E,0x03,0x80,0x0E,0x03,0xC0,0x0E,0x01,0xE0,0x0E,
- 0x00,0xE0,0x0E,0x00,0xF0,0x7F,0xC3,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"k",75*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x04,0x00,0x00,0x1C,0x00,0x07,0xFC,0x00,0x00,0x1C,0x00,0x00,0x1C,
- 0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,
- 0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,
- 0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,
- 0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,
- 0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,
- 0x1C,0x00,0x00,0x1C,0x00,0x07,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"l",76*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0xF9,0xF1,0xE0,0x3B,0xF3,0xF0,0x3E,
- 0x3E,0x38,0x3C,0x3C,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,
- 0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,
- 0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,
- 0x38,0x38,0x38,0x38,0x38,0xFE,0xFE,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"m",77*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x7E,0x1F,0x80,0x0E,0x7F,0xC0,0x0E,
- 0xE1,0xE0,0x0F,0xC0,0xF0,0x0F,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,
- 0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,
- 0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,
- 0x00,0x70,0x0E,0x00,0x70,0x7F,0xC3,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"n",78*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x01,0xC3,0x80,0x03,
- 0x00,0xE0,0x06,0x00,0x70,0x0C,0x00,0x30,0x1C,0x00,0x38,0x1C,0x00,0x38,0x38,0x00,
- 0x1C,0x38,0x00,0x1C,0x38,0x00,0x1C,0x38,0x00,0x1C,0x38,0x00,0x1C,0x38,0x00,0x1C,
- 0x38,0x00,0x1C,0x18,0x00,0x18,0x1C,0x00,0x38,0x0C,0x00,0x30,0x0E,0x00,0x70,0x07,
- 0x00,0xE0,0x01,0x81,0x80,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"o",79*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x7E,0x1F,0x00,0x0E,0x7F,0xC0,0x0E,
- 0xE0,0xF0,0x0F,0x80,0x70,0x0F,0x00,0x38,0x0E,0x00,0x38,0x0E,0x00,0x1C,0x0E,0x00,
- 0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,
- 0x0E,0x00,0x1C,0x0E,0x00,0x18,0x0E,0x00,0x38,0x0E,0x00,0x38,0x0F,0x00,0x70,0x0F,
- 0x80,0xE0,0x0E,0xC1,0xC0,0x0E,0x3F,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,
- 0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x7F,0xC0,0x00,0x00,0x00,0x00},/*"p",80*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x20,0x03,0x86,0x60,0x06,
- 0x01,0xE0,0x0E,0x01,0xE0,0x1C,0x00,0xE0,0x1C,0x00,0xE0,0x18,0x00,0xE0,0x38,0x00,
- 0xE0,0x38,0x00,0xE0,0x38,0x00,0xE0,0x38,0x00,0xE0,0x38,0x00,0xE0,0x38,0x00,0xE0,
- 0x38,0x00,0xE0,0x38,0x00,0xE0,0x1C,0x00,0xE0,0x1C,0x01,0xE0,0x0E,0x01,0xE0,0x0F,
- 0x07,0xE0,0x03,0xFE,0xE0,0x01,0xF8,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,
- 0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x07,0xFC,0x00,0x00,0x00},/*"q",81*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x00,0x3F,0xC0,0xF0,0x01,0xC3,0xFC,0x01,
- 0xC6,0x3C,0x01,0xCC,0x3C,0x01,0xD8,0x38,0x01,0xF0,0x00,0x01,0xE0,0x00,0x01,0xE0,
- 0x00,0x01,0xC0,0x00,0x01,0xC0,0x00,0x01,0xC0,0x00,0x01,0xC0,0x00,0x01,0xC0,0x00,
- 0x01,0xC0,0x00,0x01,0xC0,0x00,0x01,0xC0,0x00,0x01,0xC0,0x00,0x01,0xC0,0x00,0x01,
- 0xC0,0x00,0x01,0xC0,0x00,0x3F,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"r",82*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x00,0x01,0xC0,0xF0,0x03,
- 0x80,0x38,0x07,0x00,0x18,0x07,0x00,0x18,0x07,0x00,0x08,0x07,0x00,0x00,0x07,0xC0,
- 0x00,0x03,0xF0,0x00,0x00,0xFE,0x00,0x00,0x3F,0xC0,0x00,0x07,0xF0,0x00,0x01,0xF8,
- 0x00,0x00,0x3C,0x08,0x00,0x3C,0x0C,0x00,0x1C,0x0C,0x00,0x1C,0x0E,0x00,0x1C,0x0F,
- 0x00,0x38,0x0F,0xC0,0x70,0x04,0x3F,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"s",83*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x30,0x00,
- 0x00,0x30,0x00,0x00,0x70,0x00,0x01,0xF0,0x00,0x1F,0xFF,0xF0,0x00,0x70,0x00,0x00,
- 0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,
- 0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,
- 0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x08,0x00,0x70,0x08,0x00,0x78,0x10,0x00,
- 0x38,0x30,0x00,0x1F,0xE0,0x00,0x0F,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"t",84*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x10,0x7E,0x03,0xF0,0x0E,0x00,0x70,0x0E,
- 0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,
- 0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,
- 0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0xF0,0x0F,0x01,0xF0,0x07,
- 0x83,0x70,0x03,0xFE,0x7E,0x01,0xF8,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"u",85*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xE1,0xFE,0x0F,0x80,0x78,0x07,
- 0x00,0x30,0x07,0x80,0x70,0x03,0x80,0x60,0x03,0x80,0x60,0x01,0xC0,0xC0,0x01,0xC0,
- 0xC0,0x01,0xE0,0xC0,0x00,0xE1,0x80,0x00,0xE1,0x80,0x00,0xF1,0x80,0x00,0x73,0x00,
- 0x00,0x73,0x00,0x00,0x3A,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x1C,0x00,0x00,
- 0x1C,0x00,0x00,0x1C,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"v",86*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x7F,0x7F,0x3C,0x1E,0x1C,0x3C,
- 0x1C,0x18,0x1C,0x1C,0x18,0x1C,0x1E,0x18,0x1C,0x1E,0x18,0x1C,0x3E,0x30,0x0E,0x3F,
- 0x30,0x0E,0x37,0x30,0x0E,0x67,0x30,0x0E,0x67,0x60,0x07,0x67,0xE0,0x07,0xE3,0xE0,
- 0x07,0xC3,0xE0,0x07,0xC3,0xC0,0x03,0xC1,0xC0,0x03,0x81,0xC0,0x03,0x81,0xC0,0x03,
- 0x81,0xC0,0x01,0x00,0x80,0x01,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"w",87*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xE3,0xF8,0x07,0xC0,0xC0,0x03,
- 0xC0,0xC0,0x01,0xC1,0x80,0x01,0xE1,0x00,0x00,0xE3,0x00,0x00,0x76,0x00,0x00,0x7E,
- 0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x1C,0x00,0x00,0x3E,0x00,0x00,0x2E,0x00,
- 0x00,0x67,0x00,0x00,0xC7,0x80,0x00,0x83,0x80,0x01,0x83,0xC0,0x03,0x01,0xC0,0x03,
- 0x01,0xE0,0x07,0x00,0xF0,0x3F,0x87,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"x",88*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xC3,0xFC,0x0F,0x00,0xE0,0x07,
- 0x00,0xE0,0x07,0x80,0xC0,0x03,0x80,0xC0,0x03,0x81,0x80,0x03,0xC1,0x80,0x01,0xC1,
- 0x80,0x01,0xE3,0x00,0x00,0xE3,0x00,0x00,0xE3,0x00,0x00,0xF6,0x00,0x00,0x76,0x00,
- 0x00,0x76,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x18,0x00,0x00,
- 0x18,0x00,0x00,0x18,0x00,0x00,0x10,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x20,
- 0x00,0x0C,0x60,0x00,0x1E,0x40,0x00,0x1F,0x80,0x00,0x0F,0x00,0x00,0x00,0x00,0x00},/*"y",89*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xFF,0xE0,0x0E,0x01,0xC0,0x1C,
- 0x03,0xC0,0x18,0x03,0x80,0x18,0x07,0x00,0x10,0x0F,0x00,0x10,0x0E,0x00,0x00,0x1E,
- 0x00,0x00,0x3C,0x00,0x00,0x38,0x00,0x00,0x78,0x00,0x00,0xF0,0x00,0x00,0xE0,0x00,
- 0x01,0xE0,0x10,0x01,0xC0,0x10,0x03,0xC0,0x30,0x07,0x80,0x20,0x07,0x00,0x60,0x0F,
- 0x00,0x60,0x1E,0x00,0xE0,0x1F,0xFF,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"z",90*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0xC0,0x00,
- 0x01,0x80,0x00,0x01,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,
- 0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,
- 0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,
- 0x03,0x00,0x00,0x06,0x00,0x00,0x0C,0x00,0x00,0x30,0x00,0x00,0x0C,0x00,0x00,0x06,
- 0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,
- 0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,
- 0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x01,
- 0x80,0x00,0x00,0xC0,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"{",91*/
-{0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,
- 0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,
- 0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,
- 0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,
- 0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,
- 0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,
- 0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,
- 0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,
- 0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00},/*"|",92*/
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x03,0x00,0x00,0x01,
- 0x80,0x00,0x00,0x80,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,
- 0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,
- 0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,
- 0xC0,0x00,0x00,0x60,0x00,0x00,0x30,0x00,0x00,0x0C,0x00,0x00,0x30,0x00,0x00,0x60,
- 0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,
- 0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,
- 0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x01,0x80,
- 0x00,0x03,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"}",93*/
-{0x03,0xC0,0x00,0x0F,0xE0,0x00,0x08,0x70,0x02,0x10,0x38,0x02,0x10,0x1C,0x04,0x20,
- 0x0E,0x04,0x20,0x07,0x88,0x00,0x03,0xF8,0x00,0x01,0xE0,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
- 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00} /*"~",94*/
-};
+//===========================================================================
+// Find the font for a character height. The fonts and their glyphs are
+// generated into fonts.c by host/fontgen.c. Returns 0 if there is none.
+//===========================================================================
+static const lcd_font_t *_LCD_Font(u8 size)
+{
+    for(const lcd_font_t *const *f = lcd_fonts; *f; f++)
+        if ((*f)->size == size)
+            return *f;
+    return 0;
+}
+
+static const lcd_glyph_t *_LCD_Glyph(const lcd_font_t *f, char num)
+{
+    u8 c = num - f->first;
+    return &f->glyphs[c < f->count ? f->map[c] : 0];
+}
+
+//===========================================================================
+// How far the next character starts after num, when next follows it:
+// the glyph's advance plus any kerning for the pair.
+//===========================================================================
+static int _LCD_Advance(const lcd_font_t *f, const lcd_glyph_t *g,
+                        char num, char next)
+{
+    for(u8 k=0; k<f->kerns; k++)
+        if (f->kern[k].left == num && f->kern[k].right == next)
+            return g->advance + f->kern[k].adjust;
+    return g->advance;
+}
+
+//===========================================================================
+// Get row pos of a glyph's character cell. Bit 0 is the leftmost pixel.
+// The glyph's box is read as 32 bits from the byte holding the row's first
+// pixel, then shifted into place in the cell.
+//===========================================================================
+static uint32_t _LCD_GlyphRow(const lcd_font_t *f, const lcd_glyph_t *g, u8 pos)
+{
+    if (pos < g->y || pos >= g->y + g->h)
+        return 0;
+    uint32_t bit = (uint32_t)(pos - g->y) * g->w;
+    const u8 *p = &f->bits[g->offset + (bit >> 3)];
+    uint32_t row = p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24;
+    return (row >> (bit & 7) & ((1u << g->w) - 1)) << g->x;
+}
 
 //===========================================================================
 // Display a single character at position x,y on the screen.
 // fc,bc are the foreground,background colors
 // num is the ASCII character number
-// size is the height of the character (either 12 or 16)
 // When mode is set, the background will be transparent.
+// An opaque character is sent as its whole cell through one window, so
+// when the background colour is known, drawing with mode 0 and bc set to
+// it is by far the cheapest way to put text on the screen. A transparent
+// character is sent as one window per horizontal run of set pixels, and
+// only the rows of the glyph's box are looked at.
 //===========================================================================
-void _LCD_DrawChar(u16 x,u16 y,u16 fc, u16 bc, char num, u8 size, u8 mode)
+static void _LCD_DrawChar(u16 x,u16 y,u16 fc, u16 bc, char num,
+                          const lcd_font_t *f, u8 mode)
 {
+    const lcd_glyph_t *g = _LCD_Glyph(f, num);
     uint32_t temp;
     u8 pos,t;
-    num=num-' ';
-    LCD_SetWindow(x,y,x+size/2-1,y+size-1);
     if (!mode) {
+        LCD_SetWindow(x,y,x+g->advance-1,y+f->height-1);
         LCD_WriteData16_Prepare();
-        for(pos=0;pos<size;pos++) {
-            if (size==12)
-                temp=asc2_1206[num][pos];
-            else if(size == 16)
-                temp=asc2_1608[num][pos];
-            else if(size == 32)
-            	temp = (asc2_3216[num][pos*2]<<8)|(asc2_3216[num][pos*2+1]);
-            else
-            	temp = (asc2_4824[num][pos*3]<<16)|(asc2_4824[num][pos*3+1]<<8)|asc2_4824[num][pos*3+2];
-            for (t=0;t<size/2;t++) {
+        for(pos=0;pos<f->height;pos++) {
+            temp=_LCD_GlyphRow(f,g,pos);
+            for (t=0;t<g->advance;t++) {
                 if (temp&0x01)
                     LCD_WriteData16(fc);
                 else
@@ -2019,52 +691,177 @@ void _LCD_DrawChar(u16 x,u16 y,u16 fc, u16 bc, char num, u8 size, u8 mode)
         }
         LCD_WriteData16_End();
     } else {
-        for(pos=0;pos<size;pos++)
+        for(pos=g->y;pos<g->y+g->h;pos++)
         {
-            if (size==12)
-                temp=asc2_1206[num][pos];
-            else if(size == 16)
-                temp=asc2_1608[num][pos];
-            else if(size == 32)
-            	temp = (asc2_3216[num][pos*2]<<8)|(asc2_3216[num][pos*2+1]);
-            else
-            	temp = (asc2_4824[num][pos*3]<<16)|(asc2_4824[num][pos*3+1]<<8)|asc2_4824[num][pos*3+2];
-            for (t=0;t<size/2;t++)
+            temp=_LCD_GlyphRow(f,g,pos);
+            t=0;
+            while (temp)
             {
-                if(temp&0x01)
-                    _LCD_DrawPoint(x+t,y+pos,fc);
-                temp>>=1;
+                u8 start;
+                while (!(temp&0x01)) {  // Skip to the next run
+                    temp>>=1;
+                    t++;
+                }
+                start=t;
+                while (temp&0x01) {     // Find where it ends
+                    temp>>=1;
+                    t++;
+                }
+                _LCD_Fill(x+start,y+pos,x+t-1,y+pos,fc);
             }
         }
     }
 }
 
+//===========================================================================
+// Display a single character. size is the height of the character; see
+// fonts/fonts.def for the heights and characters built in.
+//===========================================================================
 void LCD_DrawChar(u16 x,u16 y,u16 fc, u16 bc, char num, u8 size, u8 mode)
 {
-    lcddev.select(1);
-    _LCD_DrawChar(x,y,fc,bc,num,size,mode);
-    lcddev.select(0);
+    const lcd_font_t *f = _LCD_Font(size);
+    if (!f)
+        return;
+    LCD_Select();
+    _LCD_DrawChar(x,y,fc,bc,num,f,mode);
+    LCD_Release();
+}
+
+//===========================================================================
+// Width in pixels of a string drawn with LCD_DrawString(), or 0 if there is
+// no font of that size. Used to right-align or centre text.
+//===========================================================================
+int LCD_MeasureString(const char *p, u8 size)
+{
+    const lcd_font_t *f = _LCD_Font(size);
+    int w = 0;
+    if (!f)
+        return 0;
+    for(; *p>=' ' && *p<='~'; p++)
+        w += _LCD_Advance(f, _LCD_Glyph(f, *p), p[0], p[1]);
+    return w;
+}
+
+//===========================================================================
+// Draw an opaque string w pixels wide through a single window.
+// Each row of the string is gathered from the glyphs into a bit mask, so
+// characters that kerning moves into each other's cells are both drawn.
+//===========================================================================
+#define LCD_ROW_WORDS ((320 + 24) / 32 + 1)
+
+static void _LCD_StringOpaque(u16 x,u16 y, u16 fc, u16 bg, const char *p,
+                              const lcd_font_t *f, int w)
+{
+    uint32_t n = 0;
+    u16 *buf = LCD_StreamBuffer();
+
+    LCD_SetWindow(x,y,x+w-1,y+f->height-1);
+    for(u8 pos=0; pos<f->height; pos++) {
+        uint32_t mask[LCD_ROW_WORDS] = { 0 };
+        int cx = 0;
+        for(const char *q = p; *q>=' ' && *q<='~' && cx < w; q++) {
+            const lcd_glyph_t *g = _LCD_Glyph(f, *q);
+            uint32_t row = _LCD_GlyphRow(f, g, pos);
+            if (row) {
+                mask[cx >> 5] |= row << (cx & 31);
+                if (cx & 31)
+                    mask[(cx >> 5) + 1] |= row >> (32 - (cx & 31));
+            }
+            cx += _LCD_Advance(f, g, q[0], q[1]);
+        }
+        for(int t=0; t<w; t++) {
+            buf[n++] = (mask[t >> 5] >> (t & 31) & 1) ? fc : bg;
+            if (n == LCD_STREAM_CHUNK) {
+                LCD_StreamSend(buf, n);
+                buf = LCD_StreamBuffer();
+                n = 0;
+            }
+        }
+    }
+    if (n)
+        LCD_StreamSend(buf, n);
 }
 
 //===========================================================================
 // Display a string of characters starting at location x,y.
 // fc,bc are the foreground,background colors.
 // p is the pointer to the string.
-// size is the height of the character (either 12 or 16)
-// When mode is set, the background will be transparent.
+// size is the height of the character (12, 16, 32 or 48), plus LCD_PROP for
+// the proportional font of that height.
+// When mode is set, the background will be transparent. Otherwise the whole
+// string, cut at the right edge of the display, is sent through one window.
 //===========================================================================
 void LCD_DrawString(u16 x,u16 y, u16 fc, u16 bg, const char *p, u8 size, u8 mode)
 {
-    lcddev.select(1);
-    while((*p<='~')&&(*p>=' '))
-    {
-        if(x>(lcddev.width-1)||y>(lcddev.height-1))
+    const lcd_font_t *f = _LCD_Font(size);
+    if (!f || x>(lcddev.width-1) || y>(lcddev.height-1))
         return;
-        _LCD_DrawChar(x,y,fc,bg,*p,size,mode);
-        x+=size/2;
-        p++;
+    LCD_Select();
+    if (!mode) {
+        int w = LCD_MeasureString(p, size);
+        if (w > lcddev.width - x)
+            w = lcddev.width - x;
+        if (w > 0)
+            _LCD_StringOpaque(x,y,fc,bg,p,f,w);
+    } else {
+        while((*p<='~')&&(*p>=' '))
+        {
+            if(x>(lcddev.width-1))
+                break;
+            _LCD_DrawChar(x,y,fc,bg,*p,f,mode);
+            x+=_LCD_Advance(f,_LCD_Glyph(f,*p),p[0],p[1]);
+            p++;
+        }
     }
-    lcddev.select(0);
+    LCD_Release();
+}
+
+//===========================================================================
+// Redraw a field of fixed-width text in place, sending only what changed.
+// shown holds the text already on the panel at (x,y), drawn in the same
+// font and colours, or "" if that is not known. Each run of characters
+// that differ from it is drawn opaque through one window, and shown is
+// updated to p, so it needs room for p. Keep p the same length from one
+// call to the next (pad it with spaces) so every old character is covered.
+// Returns the number of characters sent.
+//===========================================================================
+int LCD_DrawStringDiff(u16 x,u16 y, u16 fc, u16 bg, const char *p,
+                       char *shown, u8 size)
+{
+    const lcd_font_t *f = _LCD_Font(size);
+    int i, start, sent = 0, known = 1;
+    if (!f || x>(lcddev.width-1) || y>(lcddev.height-1))
+        return 0;
+    int cw = _LCD_Glyph(f, ' ')->advance;
+
+    LCD_Select();
+    for(i=0; p[i]>=' ' && p[i]<='~'; ) {
+        if (known && shown[i] == 0)
+            known = 0;
+        if (known && shown[i] == p[i]) {
+            i++;
+            continue;
+        }
+        start = i;                      // Find the end of the changed run
+        do {
+            shown[i] = p[i];
+            i++;
+            if (known && shown[i] == 0)
+                known = 0;
+        } while (p[i]>=' ' && p[i]<='~' && !(known && shown[i] == p[i]));
+
+        int cx = x + start*cw;
+        int w = (i - start)*cw;
+        if (cx > lcddev.width - 1)
+            break;
+        if (w > lcddev.width - cx)
+            w = lcddev.width - cx;
+        _LCD_StringOpaque(cx,y,fc,bg,p+start,f,w);
+        sent += i - start;
+    }
+    shown[i] = 0;
+    LCD_Release();
+    return sent;
 }
 
 //===========================================================================
@@ -2072,7 +869,7 @@ void LCD_DrawString(u16 x,u16 y, u16 fc, u16 bg, const char *p, u8 size, u8 mode
 //===========================================================================
 void LCD_DrawPicture(u16 x0, u16 y0, const Picture *pic)
 {
-    lcddev.select(1);
+    LCD_Select();
     u16 x1 = x0 + pic->width-1;
     u16 y1 = y0 + pic->height-1;
     // No error handling.  Just loop forever if out-of-bounds.
@@ -2085,50 +882,340 @@ void LCD_DrawPicture(u16 x0, u16 y0, const Picture *pic)
     while (y1 >= lcddev.height)
         ;
     LCD_SetWindow(x0,y0,x1,y1);
-    LCD_WriteData16_Prepare();
-
-    u16 *data = (u16 *)pic->pixel_data;
-    for(int y=0; y<pic->height; y++) {
-        u16 *row = &data[y * pic->width];
-        for(int x=0; x<pic->width; x++)
-            LCD_WriteData16(*row++);
-    }
-
-    LCD_WriteData16_End();
-    lcddev.select(0);
+    // Streams straight from flash by DMA.
+    LCD_WritePixels((const u16 *)pic->pixel_data, pic->width * pic->height);
+    LCD_Release();
 }
 
 //===========================================================================
 // Draw an image at (x,y).
+// Image holds one byte of each RGB16 pixel per entry, high byte first.
+// Pixels are converted a chunk at a time and streamed, so the converted
+// image is never held in RAM.
 //===========================================================================
 void LCD_Draw_Sprite(u16 *Image, int width, int height, u16 x0, u16 y0)
 {
-    u16 ConvertedImage[width*height];
-
-    //Combine the hex values defined in the image array to convert them to RGB16
-    for(int i = 0; i <  2 * width * height; i+=2){
-        ConvertedImage[i/2] = (Image[i] << 8) + Image[i + 1];
-    }
-
     //Calculate Coordinates
     u16 x1 = x0 + width-1;
     u16 y1 = y0 + height-1;
 
-
     //Draw Image on LCD
-    lcddev.select(1);
-    int pixel = 0; //define pixel #
-    unsigned int i,m; //for loop control variables
+    LCD_Select();
     LCD_SetWindow(x0,y0,x1,y1); //LCD Window Setup
-    LCD_WriteData16_Prepare(); //LCD Data Transmission Setup
-    for(i=0;i<height;i++)
-    {
-        for(m=0;m<width;m++)
-        {
-            LCD_WriteData16(ConvertedImage[pixel++]); //Send data for each pixel to the LCD
+    uint32_t left = (uint32_t)width * height;
+    while(left) {
+        uint32_t n = left > LCD_STREAM_CHUNK ? LCD_STREAM_CHUNK : left;
+        u16 *buf = LCD_StreamBuffer();
+        //Combine the hex values defined in the image array to convert them to RGB16
+        for(uint32_t i = 0; i < n; i++, Image += 2)
+            buf[i] = (Image[0] << 8) + Image[1];
+        LCD_StreamSend(buf, n);
+        left -= n;
+    }
+    LCD_Release();
+}
+
+//===========================================================================
+// Compressed images.
+// The image is decoded into the stream buffers LCD_STREAM_CHUNK pixels at a
+// time and sent through one window, so drawing it takes the same small
+// amount of RAM whatever its size. The data is a byte stream:
+//   LCD_IMG_RGB565  two bytes per pixel, low byte first.
+//   LCD_IMG_RLE565  packets, each a count byte and pixels. If bit 7 of the
+//                   count is set, one pixel follows and is repeated
+//                   (count & 0x7f) + 1 times; otherwise (count + 1) pixels
+//                   follow as they are.
+//   LCD_IMG_PALn    palette indices of n bits, the first pixel in the high
+//                   bits of a byte. Each row starts on a new byte.
+//===========================================================================
+typedef struct {
+    const u8 *p;        // Next byte of the data
+    u16 run;            // RLE: pixels left in the packet
+    u8  repeat;         // RLE: the packet repeats one pixel
+    u8  byte, bits;     // Palette: current byte and its bits not yet used
+    u16 x;              // Palette: column
+} _lcd_image_pos_t;
+
+static void _LCD_ImageDecode(const lcd_image_t *img, _lcd_image_pos_t *pos,
+                             u16 *buf, uint32_t n)
+{
+    uint32_t i;
+    switch (img->format) {
+    case LCD_IMG_RGB565:
+        for(i = 0; i < n; i++, pos->p += 2)
+            buf[i] = pos->p[0] | pos->p[1] << 8;
+        break;
+    case LCD_IMG_RLE565:
+        for(i = 0; i < n; i++) {
+            if (pos->run == 0) {
+                pos->repeat = *pos->p & 0x80;
+                pos->run = (*pos->p++ & 0x7f) + 1;
+            }
+            buf[i] = pos->p[0] | pos->p[1] << 8;
+            if (!pos->repeat || pos->run == 1)
+                pos->p += 2;
+            pos->run--;
         }
+        break;
+    default: {
+        u8 bpp = img->format;
+        u8 mask = (1 << bpp) - 1;
+        for(i = 0; i < n; i++) {
+            if (pos->bits == 0) {
+                pos->byte = *pos->p++;
+                pos->bits = 8;
+            }
+            pos->bits -= bpp;
+            buf[i] = img->palette[(pos->byte >> pos->bits) & mask];
+            if (++pos->x == img->width) {   // Next row, next byte
+                pos->x = 0;
+                pos->bits = 0;
+            }
+        }
+        break;
+    }
     }
-    LCD_WriteData16_End(); //LCD Transmission End
-    lcddev.select(0);
 }
 
+//===========================================================================
+// Draw a compressed image with its top-left corner at (x0,y0).
+// Returns -1 without drawing if the image does not fit on the display or
+// its format is unknown.
+//===========================================================================
+int LCD_DrawImage(u16 x0, u16 y0, const lcd_image_t *img)
+{
+    _lcd_image_pos_t pos = { .p = img->data };
+    uint32_t left = (uint32_t)img->width * img->height;
+
+    switch (img->format) {
+    case LCD_IMG_PAL1: case LCD_IMG_PAL2: case LCD_IMG_PAL4:
+    case LCD_IMG_RGB565: case LCD_IMG_RLE565:
+        break;
+    default:
+        return -1;
+    }
+    if (left == 0 || x0 + img->width > lcddev.width ||
+        y0 + img->height > lcddev.height)
+        return -1;
+
+    LCD_Select();
+    LCD_SetWindow(x0,y0,x0+img->width-1,y0+img->height-1);
+    while(left) {
+        uint32_t n = left > LCD_STREAM_CHUNK ? LCD_STREAM_CHUNK : left;
+        u16 *buf = LCD_StreamBuffer();
+        _LCD_ImageDecode(img, &pos, buf, n);
+        LCD_StreamSend(buf, n);
+        left -= n;
+    }
+    LCD_Release();
+    return 0;
+}
+
+
+//===========================================================================
+// Band compositor.
+// A frame (or any rectangle of the screen) is described by a display list
+// of rectangles, text and pictures, drawn in order over a background
+// colour. Instead of sending each item to the panel, the region is
+// rasterised a few lines at a time into a RAM band buffer, and the bands
+// are streamed through a single window. Every pixel of the region is sent
+// exactly once, so nothing is drawn and then drawn over, and nothing
+// flickers. Two band buffers alternate: one is rasterised while the other
+// is going out by DMA.
+//===========================================================================
+#define LCD_BAND_PIXELS 1280    // 4 lines of 320
+static u16 band_buf[2][LCD_BAND_PIXELS];
+
+static void _LCD_BandRect(const lcd_dl_t *d, u16 *buf, int bx0, int bx1,
+                          int by0, int by1)
+{
+    int x0 = d->x > bx0 ? d->x : bx0;
+    int x1 = d->x + d->w - 1 < bx1 ? d->x + d->w - 1 : bx1;
+    int y0 = d->y > by0 ? d->y : by0;
+    int y1 = d->y + d->h - 1 < by1 ? d->y + d->h - 1 : by1;
+    int stride = bx1 - bx0 + 1;
+    for(int y = y0; y <= y1; y++) {
+        u16 *p = &buf[(y - by0) * stride + x0 - bx0];
+        for(int x = x0; x <= x1; x++)
+            *p++ = d->c;
+    }
+}
+
+static void _LCD_BandText(const lcd_dl_t *d, u16 *buf, int bx0, int bx1,
+                          int by0, int by1)
+{
+    const lcd_font_t *f = _LCD_Font(d->size);
+    if (!f)
+        return;
+    int y0 = d->y > by0 ? d->y : by0;
+    int y1 = d->y + f->height - 1 < by1 ? d->y + f->height - 1 : by1;
+    int stride = bx1 - bx0 + 1;
+    int cx = d->x;
+    for(const char *p = d->data; *p >= ' ' && *p <= '~'; p++) {
+        const lcd_glyph_t *g = _LCD_Glyph(f, *p);
+        int cw = g->advance;
+        if (cx > bx1)
+            break;
+        if (cx + cw - 1 >= bx0) {
+            for(int y = y0; y <= y1; y++) {
+                uint32_t row = _LCD_GlyphRow(f, g, y - d->y);
+                u16 *line = &buf[(y - by0) * stride];
+                for(int t = 0; row; t++, row >>= 1)
+                    if ((row & 1) && cx + t >= bx0 && cx + t <= bx1)
+                        line[cx + t - bx0] = d->c;
+            }
+        }
+        cx += _LCD_Advance(f, g, p[0], p[1]);
+    }
+}
+
+static void _LCD_BandPicture(const lcd_dl_t *d, u16 *buf, int bx0, int bx1,
+                             int by0, int by1)
+{
+    const Picture *pic = d->data;
+    const u16 *pix = (const u16 *)pic->pixel_data;
+    int x0 = d->x > bx0 ? d->x : bx0;
+    int x1 = d->x + (int)pic->width - 1 < bx1 ? d->x + (int)pic->width - 1 : bx1;
+    int y0 = d->y > by0 ? d->y : by0;
+    int y1 = d->y + (int)pic->height - 1 < by1 ? d->y + (int)pic->height - 1 : by1;
+    int stride = bx1 - bx0 + 1;
+    for(int y = y0; y <= y1; y++) {
+        const u16 *src = &pix[(y - d->y) * pic->width + x0 - d->x];
+        u16 *dst = &buf[(y - by0) * stride + x0 - bx0];
+        for(int x = x0; x <= x1; x++)
+            *dst++ = *src++;
+    }
+}
+
+//===========================================================================
+// Draw the display list dl (n items, in order, over colour bg) into the
+// region (x0,y0)-(x1,y1). Items may extend past the region; they are
+// clipped to it.
+//===========================================================================
+void LCD_Compose(u16 x0, u16 y0, u16 x1, u16 y1, u16 bg,
+                 const lcd_dl_t *dl, int n)
+{
+    int width = x1 - x0 + 1;
+    int lines = LCD_BAND_PIXELS / width;
+    int next  = 0;
+
+    LCD_Select();
+    LCD_SetWindow(x0,y0,x1,y1);
+    for(int by0 = y0; by0 <= y1; by0 += lines) {
+        int by1 = by0 + lines - 1 > y1 ? y1 : by0 + lines - 1;
+        u16 *buf = band_buf[next];
+        int count = (by1 - by0 + 1) * width;
+        for(int k = 0; k < count; k++)
+            buf[k] = bg;
+        for(int k = 0; k < n; k++) {
+            const lcd_dl_t *d = &dl[k];
+            int h = d->h;
+            if (d->type == LCD_DL_TEXT) {
+                // The size carries LCD_PROP, so it is not the height.
+                const lcd_font_t *f = _LCD_Font(d->size);
+                if (!f)
+                    continue;
+                h = f->height;
+            } else if (d->type == LCD_DL_PICTURE)
+                h = ((const Picture *)d->data)->height;
+            if (d->y > by1 || d->y + h - 1 < by0)
+                continue;
+            if (d->type == LCD_DL_RECT)
+                _LCD_BandRect(d, buf, x0, x1, by0, by1);
+            else if (d->type == LCD_DL_TEXT)
+                _LCD_BandText(d, buf, x0, x1, by0, by1);
+            else if (d->type == LCD_DL_PICTURE)
+                _LCD_BandPicture(d, buf, x0, x1, by0, by1);
+        }
+        // The window stays open, so each band continues the same RAM write.
+        LCD_WritePixels(buf, count);
+        next ^= 1;
+    }
+    LCD_Release();
+}
+
+//===========================================================================
+// Draw one column x from y0 to y1 in a single window: the background
+// colour bg with runs of other colours over it, later runs covering earlier
+// ones. With no runs it erases the column. Either way it costs one window
+// and y1-y0+1 pixels, which is what a strip chart pays per sample.
+//===========================================================================
+void LCD_DrawColumn(u16 x, u16 y0, u16 y1, u16 bg, const lcd_run_t *runs, int n)
+{
+    LCD_Select();
+    LCD_SetWindow(x,y0,x,y1);
+    for(int y = y0; y <= y1; y += LCD_STREAM_CHUNK) {
+        int count = y1 - y + 1 > LCD_STREAM_CHUNK ? LCD_STREAM_CHUNK : y1 - y + 1;
+        u16 *buf = LCD_StreamBuffer();
+        for(int k = 0; k < count; k++)
+            buf[k] = bg;
+        for(int r = 0; r < n; r++) {
+            int a = runs[r].y0 > y ? runs[r].y0 : y;
+            int b = runs[r].y1 < y + count - 1 ? runs[r].y1 : y + count - 1;
+            for(int k = a; k <= b; k++)
+                buf[k - y] = runs[r].c;
+        }
+        LCD_StreamSend(buf, count);
+    }
+    LCD_Release();
+}
+
+//===========================================================================
+// Hardware scrolling.
+// The ILI9341 can scroll one band of lines along its long side, between a
+// fixed area before it and one after it: in landscape (MV=1) that is a band
+// of columns, the full height of the screen. Scrolling only changes which
+// RAM line each line of the band shows, so it costs one short command.
+// Drawing inside the band still addresses RAM, so only code that knows the
+// offset (the strip chart) should draw there while it is scrolled.
+//
+// The band runs along the panel's RAM lines, which MY mirrors; with MY set
+// (rotations 2 and 3) the fixed areas and the direction are swapped here so
+// that callers can work in screen coordinates.
+//===========================================================================
+static u16 scroll_top;      // First RAM line of the band
+static u16 scroll_lines;    // Lines in the band
+
+static void _LCD_ScrollCmd(uint8_t cmd, const u16 *params, int n)
+{
+    LCD_Select();
+    LCD_QueueCmd(cmd, params, n);
+    LCD_SendCmds();
+    LCD_Release();
+}
+
+//===========================================================================
+// Make screen lines first..last (columns in landscape, rows in portrait)
+// the scrolling band, and show it unscrolled.
+//===========================================================================
+void LCD_ScrollArea(u16 first, u16 last)
+{
+    u16 p[3];
+    if (lcddev.dir >= 2) {
+        p[0] = LCD_H - 1 - last;
+        p[2] = first;
+    } else {
+        p[0] = first;
+        p[2] = LCD_H - 1 - last;
+    }
+    p[1] = last - first + 1;
+    scroll_top = p[0];
+    scroll_lines = p[1];
+    _LCD_ScrollCmd(0x33, p, 3);   // Vertical Scrolling Definition
+    LCD_Scroll(0);
+}
+
+//===========================================================================
+// Scroll the band so that its i-th line on screen shows what was drawn at
+// its line (i + offset) % lines.
+//===========================================================================
+void LCD_Scroll(u16 offset)
+{
+    if (scroll_lines == 0)
+        return;
+    offset %= scroll_lines;
+    if (lcddev.dir >= 2 && offset)
+        offset = scroll_lines - offset;
+    u16 vsp = scroll_top + offset;
+    _LCD_ScrollCmd(0x37, &vsp, 1);  // Vertical Scrolling Start Address
+}
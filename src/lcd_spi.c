@@ -0,0 +1,468 @@
+//============================================================================
+// lcd_spi.c: The SPI side of the LCD driver.
+// Everything in here touches SPI1, DMA1 or the LCD's GPIO pins; lcd.c
+// only draws through the functions in lcd_spi.h. On a PC this file is
+// built against the register model in host/sim_lcd.c.
+//============================================================================
+
+#include "stm32f0xx.h"
+#include <stdint.h>
+#include <stdio.h>
+#include "lcd.h"
+#include "lcd_spi.h"
+
+#define SPI SPI1
+
+#define CS_NUM  8
+#define CS_BIT  (1<<CS_NUM)
+#define CS_HIGH do { GPIOB->BSRR = GPIO_BSRR_BS_8; } while(0)
+#define CS_LOW do { GPIOB->BSRR = GPIO_BSRR_BR_8; } while(0)
+#define RESET_NUM 11
+#define RESET_BIT (1<<RESET_NUM)
+#define RESET_HIGH do { GPIOB->BSRR = GPIO_BSRR_BS_11; } while(0)
+#define RESET_LOW  do { GPIOB->BSRR = GPIO_BSRR_BR_11; } while(0)
+#define DC_NUM 14
+#define DC_BIT (1<<DC_NUM)
+#define DC_HIGH do { GPIOB->BSRR = GPIO_BSRR_BS_14; } while(0)
+#define DC_LOW  do { GPIOB->BSRR = GPIO_BSRR_BR_14; } while(0)
+
+// Every write to the SPI FIFO and every wait for the bus to go idle goes
+// through these. The host model (host/stm32f0xx.h) defines its own, so it
+// sees each byte and word as it is written.
+#ifndef spi_write8
+static inline void spi_write8(uint8_t data)
+{
+    *((uint8_t*)&SPI->DR) = data;
+}
+
+static inline void spi_write16(u16 data)
+{
+    SPI->DR = data;
+}
+
+static inline void spi_drain(void)
+{
+    while((SPI->SR & SPI_SR_BSY) != 0)
+        ;
+}
+#endif
+
+// Set the CS pin low if val is non-zero.
+// Note that when CS is being set high again, wait on SPI to not be busy.
+void tft_select(int val)
+{
+    if (val == 0) {
+        spi_drain();
+        CS_HIGH;
+    } else {
+        while((GPIOB->ODR & (CS_BIT)) == 0) {
+            ; // If CS is already low, this is an error.  Loop forever.
+            // This has happened because something called a drawing subroutine
+            // while one was already in process.  For instance, the main()
+            // subroutine could call a long-running LCD_DrawABC function,
+            // and an ISR interrupts it and calls another LCD_DrawXYZ function.
+            // This is a common mistake made by students.
+            // This is what catches the problem early.
+        }
+        CS_LOW;
+    }
+}
+
+// If val is non-zero, set nRESET low to reset the display.
+void tft_reset(int val)
+{
+    if (val) {
+        RESET_LOW;
+    } else {
+        RESET_HIGH;
+    }
+}
+
+// If
+void tft_reg_select(int val)
+{
+    if (val == 1) { // select registers
+        DC_LOW; // clear
+    } else { // select data
+        DC_HIGH; // set
+    }
+}
+
+// If you want to try the slower version of SPI, #define SLOW_SPI
+
+#if defined(SLOW_SPI)
+
+// What GPIO port and SPI channel are we using here?
+#define CSPORT GPIOB
+#define LCD_CS    10 /* also known as NSS */
+#define RSPORT GPIOA
+#define LCD_RS    3
+#define RESETPORT GPIOB
+#define LCD_RESET 11
+
+#define LCD_CS_SET  do { spi_drain(); CSPORT->BSRR=1<<LCD_CS; } while(0)
+#define LCD_RS_SET  RSPORT->BSRR=1<<LCD_RS
+#define LCD_RESET_SET RESETPORT->BSRR=1<<LCD_RESET
+
+#define LCD_CS_CLR  CSPORT->BRR=1<<LCD_CS
+#define LCD_RS_CLR  RSPORT->BRR=1<<LCD_RS
+#define LCD_RESET_CLR RESETPORT->BRR=1<<LCD_RESET
+
+// Write a byte to SPI.
+void SPI_WriteByte(uint8_t Data)
+{
+    while((SPI->SR & SPI_SR_TXE) == 0)
+        ;
+    spi_write8(Data);
+}
+
+// Write to an LCD "register"
+void LCD_WR_REG(uint8_t data)
+{
+    lcddev.reg_select(1);
+    SPI_WriteByte(data);
+}
+
+// Write 8-bit data to the LCD
+void LCD_WR_DATA(uint8_t data)
+{
+    lcddev.reg_select(0);
+    SPI_WriteByte(data);
+}
+
+// Prepare to write 16-bit data to the LCD
+void LCD_WriteData16_Prepare()
+{
+    lcddev.reg_select(0);
+}
+
+// Write 16-bit data
+void LCD_WriteData16(u16 Data)
+{
+    SPI_WriteByte(Data>>8);
+    SPI_WriteByte(Data);
+}
+
+// Finish writing 16-bit data
+void LCD_WriteData16_End()
+{
+}
+
+#else /* not SLOW_SPI */
+
+// Write to an LCD "register"
+void LCD_WR_REG(uint8_t data)
+{
+    LCD_DMA_Wait();
+    spi_drain();
+    // Don't clear RS until the previous operation is done.
+    lcddev.reg_select(1);
+    spi_write8(data);
+}
+
+// Write 8-bit data to the LCD
+void LCD_WR_DATA(uint8_t data)
+{
+    LCD_DMA_Wait();
+    spi_drain();
+    // Don't set RS until the previous operation is done.
+    lcddev.reg_select(0);
+    spi_write8(data);
+}
+
+// Prepare to write 16-bit data to the LCD
+void LCD_WriteData16_Prepare()
+{
+    LCD_DMA_Wait();
+    lcddev.reg_select(0);
+    SPI->CR2 |= SPI_CR2_DS;
+}
+
+// Write 16-bit data
+void LCD_WriteData16(u16 data)
+{
+    while((SPI->SR & SPI_SR_TXE) == 0)
+        ;
+    spi_write16(data);
+}
+
+// Finish writing 16-bit data
+void LCD_WriteData16_End()
+{
+    SPI->CR2 &= ~SPI_CR2_DS; // bad value forces it back to 8-bit mode
+}
+#endif /* not SLOW_SPI */
+
+//===========================================================================
+// Command batching.
+// Sending a command byte by byte costs a wait for the bus to drain and a
+// D/C update for every byte, although D/C only has to change between a
+// command and its parameters. Queued commands go out with one drain per
+// change, and their parameters as 16-bit words fed to the FIFO back to
+// back, so a whole address window is three short bursts.
+//===========================================================================
+typedef struct {
+    uint8_t cmd;
+    uint8_t n;
+    u16     params[LCD_CMD_PARAMS];
+} lcd_cmd_t;
+
+static lcd_cmd_t cmd_queue[LCD_CMD_QUEUE];
+static int       cmd_queued;
+
+void LCD_QueueCmd(uint8_t cmd, const u16 *params, int n)
+{
+    if (cmd_queued == LCD_CMD_QUEUE)
+        LCD_SendCmds();
+    lcd_cmd_t *q = &cmd_queue[cmd_queued++];
+    q->cmd = cmd;
+    q->n = n;
+    for(int i=0; i<n; i++)
+        q->params[i] = params[i];
+}
+
+#if defined(SLOW_SPI)
+void LCD_SendCmds(void)
+{
+    for(int k=0; k<cmd_queued; k++) {
+        LCD_WR_REG(cmd_queue[k].cmd);
+        lcddev.reg_select(0);
+        for(int i=0; i<cmd_queue[k].n; i++) {
+            SPI_WriteByte(cmd_queue[k].params[i]>>8);
+            SPI_WriteByte(cmd_queue[k].params[i]);
+        }
+    }
+    cmd_queued = 0;
+    spi_drain();
+}
+#else /* not SLOW_SPI */
+void LCD_SendCmds(void)
+{
+    LCD_DMA_Wait();
+    for(int k=0; k<cmd_queued; k++) {
+        const lcd_cmd_t *q = &cmd_queue[k];
+        spi_drain();
+        lcddev.reg_select(1);
+        spi_write8(q->cmd);
+        if (q->n == 0)
+            continue;
+        // D/C is sampled with the last bit of the command byte.
+        spi_drain();
+        lcddev.reg_select(0);
+        SPI->CR2 |= SPI_CR2_DS;
+        for(int i=0; i<q->n; i++) {
+            while((SPI->SR & SPI_SR_TXE) == 0)
+                ;
+            spi_write16(q->params[i]);
+        }
+        // Change the frame size back only once the words are out.
+        spi_drain();
+        SPI->CR2 &= ~SPI_CR2_DS;
+    }
+    cmd_queued = 0;
+    spi_drain();
+}
+#endif /* not SLOW_SPI */
+
+//===========================================================================
+// DMA pixel streaming.
+// DMA1 channel 3 feeds SPI1_TX with 16-bit words while the CPU goes on with
+// other work. A solid fill sends one colour word over and over (memory
+// increment off), so even a full-screen clear needs no buffer; pictures are
+// streamed straight from flash. Transfers longer than the 65535-word DMA
+// limit are chained from the interrupt.
+//
+// When a transfer completes, _LCD_DMA_Done() restores 8-bit mode and, if
+// the drawing call that started it has already returned, releases the
+// display. Anything that needs the SPI bus again first waits in
+// LCD_DMA_Wait(), which also finishes the transfer itself if it was called
+// from code the DMA interrupt cannot preempt.
+//===========================================================================
+#if !defined(SLOW_SPI)
+#define LCD_DMA_MIN   32      // Shorter transfers are cheaper to poll out
+#define LCD_DMA_MAX   0xffff  // CNDTR is 16 bits
+
+static volatile int      dma_busy;
+static volatile int      dma_release;  // Release the display when done
+static volatile uint32_t dma_left;     // Words not yet handed to the DMA
+static const u16        *dma_src;
+static int               dma_minc;
+static u16               dma_color;    // Source word for solid fills
+static u16               dma_buf[2][LCD_STREAM_CHUNK];
+static int               dma_buf_next;
+
+static void _LCD_DMA_Next(void)
+{
+    uint32_t n = dma_left > LCD_DMA_MAX ? LCD_DMA_MAX : dma_left;
+    DMA1_Channel3->CCR  &= ~DMA_CCR_EN;
+    DMA1_Channel3->CMAR  = (uint32_t)(dma_minc ? dma_src : &dma_color);
+    DMA1_Channel3->CNDTR = n;
+    DMA1_Channel3->CCR   = DMA_CCR_DIR | DMA_CCR_MSIZE_0 | DMA_CCR_PSIZE_0
+                         | DMA_CCR_TCIE | (dma_minc ? DMA_CCR_MINC : 0);
+    DMA1_Channel3->CCR  |= DMA_CCR_EN;
+    dma_left -= n;
+    if (dma_minc)
+        dma_src += n;
+}
+
+static void _LCD_DMA_Done(void)
+{
+    DMA1->IFCR = DMA_IFCR_CGIF3;
+    if (dma_left) {
+        _LCD_DMA_Next();
+        return;
+    }
+    DMA1_Channel3->CCR &= ~DMA_CCR_EN;
+    spi_drain();                        // Let the FIFO drain
+    SPI->CR2 &= ~SPI_CR2_TXDMAEN;
+    LCD_WriteData16_End();
+    dma_busy = 0;
+    if (dma_release) {
+        dma_release = 0;
+        lcddev.select(0);
+    }
+}
+
+void DMA1_Ch2_3_DMA2_Ch1_2_IRQHandler(void)
+{
+    if (DMA1->ISR & DMA_ISR_TCIF3)
+        _LCD_DMA_Done();
+}
+
+// Wait for the current transfer (if any) to finish.
+void LCD_DMA_Wait(void)
+{
+    while(dma_busy) {
+        // Keep the interrupt from finishing it at the same time as we do.
+        NVIC->ICER[0] = 1 << DMA1_Ch2_3_DMA2_Ch1_2_IRQn;
+        if (dma_busy && (DMA1->ISR & DMA_ISR_TCIF3))
+            _LCD_DMA_Done();
+        NVIC->ISER[0] = 1 << DMA1_Ch2_3_DMA2_Ch1_2_IRQn;
+    }
+}
+
+int LCD_Busy(void)
+{
+    return dma_busy;
+}
+
+// Start sending n words from src (or n copies of one word if minc is 0).
+static void _LCD_DMA_Start(const u16 *src, uint32_t n, int minc)
+{
+    LCD_DMA_Wait();
+    LCD_WriteData16_Prepare();
+    dma_busy  = 1;
+    dma_minc  = minc;
+    dma_src   = src;
+    dma_left  = n;
+    if (!minc)
+        dma_color = *src;
+    SPI->CR2 |= SPI_CR2_TXDMAEN;
+    _LCD_DMA_Next();
+}
+
+void LCD_DMA_Init(void)
+{
+    RCC->AHBENR |= RCC_AHBENR_DMA1EN;
+    DMA1_Channel3->CCR  = 0;
+    DMA1_Channel3->CPAR = (uint32_t)&SPI->DR;
+    // No request is mapped to channel 3 after reset on the F09x.
+    DMA1_CSELR->CSELR = (DMA1_CSELR->CSELR & ~DMA_CSELR_C3S) | DMA1_CSELR_CH3_SPI1_TX;
+    NVIC->ISER[0] = 1 << DMA1_Ch2_3_DMA2_Ch1_2_IRQn;
+}
+#else /* SLOW_SPI */
+void LCD_DMA_Wait(void) { }
+int LCD_Busy(void) { return 0; }
+void LCD_DMA_Init(void) { }
+#endif /* SLOW_SPI */
+
+//===========================================================================
+// Send n pixels of one colour, or n pixels from src, to the current window.
+// Long runs go out by DMA and may still be in progress on return.
+//===========================================================================
+void LCD_FillPixels(u16 c, uint32_t n)
+{
+#if !defined(SLOW_SPI)
+    if (n >= LCD_DMA_MIN) {
+        _LCD_DMA_Start(&c, n, 0);
+        return;
+    }
+#endif
+    LCD_WriteData16_Prepare();
+    while(n--)
+        LCD_WriteData16(c);
+    LCD_WriteData16_End();
+}
+
+void LCD_WritePixels(const u16 *src, uint32_t n)
+{
+#if !defined(SLOW_SPI)
+    if (n >= LCD_DMA_MIN) {
+        _LCD_DMA_Start(src, n, 1);
+        return;
+    }
+#endif
+    LCD_WriteData16_Prepare();
+    while(n--)
+        LCD_WriteData16(*src++);
+    LCD_WriteData16_End();
+}
+
+//===========================================================================
+// Stream pixels that have to be computed (converted or decoded) first.
+// Fill the buffer from LCD_StreamBuffer() with up to LCD_STREAM_CHUNK
+// pixels and pass it to LCD_StreamSend(). The two buffers alternate, so
+// the next chunk is prepared while the previous one is still going out.
+//===========================================================================
+#if !defined(SLOW_SPI)
+u16 *LCD_StreamBuffer(void)
+{
+    return dma_buf[dma_buf_next];
+}
+
+void LCD_StreamSend(u16 *buf, uint32_t n)
+{
+    _LCD_DMA_Start(buf, n, 1);
+    dma_buf_next ^= 1;
+}
+#else
+static u16 stream_buf[LCD_STREAM_CHUNK];
+u16 *LCD_StreamBuffer(void)
+{
+    return stream_buf;
+}
+
+void LCD_StreamSend(u16 *buf, uint32_t n)
+{
+    LCD_WritePixels(buf, n);
+}
+#endif
+
+//===========================================================================
+// Claim the display for a drawing call, and give it back. If pixels are
+// still going out by DMA, the DMA interrupt releases it when they are done.
+//===========================================================================
+void LCD_Select(void)
+{
+    LCD_DMA_Wait();
+    lcddev.select(1);
+}
+
+void LCD_Release(void)
+{
+#if !defined(SLOW_SPI)
+    NVIC->ICER[0] = 1 << DMA1_Ch2_3_DMA2_Ch1_2_IRQn;
+    if (dma_busy) {
+        dma_release = 1;
+        NVIC->ISER[0] = 1 << DMA1_Ch2_3_DMA2_Ch1_2_IRQn;
+        return;
+    }
+    NVIC->ISER[0] = 1 << DMA1_Ch2_3_DMA2_Ch1_2_IRQn;
+#endif
+    lcddev.select(0);
+}
+
+__attribute((weak)) void init_lcd_spi(void)
+{
+    printf("init_lcd_spi() not defined.");
+}
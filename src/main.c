@@ -9,6 +9,12 @@
 #include "accelerometer_algorithms.h"
 #include "sensors.h"
 #include "lcd.h"
+#include "bus_scheduler.h"
+#include "clock.h"
+#include "history.h"
+#include "display.h"
+#include "sched.h"
+#include "profile.h"
 
 #define NO_INIT_GCC __attribute__ ((section (".noinit")))
 
@@ -25,6 +31,8 @@
 #define TEST_ENCODER 0x40
 #define TEST_TEMP	 0x80
 #define TEST_AUDIO   0x100
+#define TEST_SCHED   0x200
+#define TEST_PROFILE 0x400   //Needs PROFILING (profile.h)
 #define TEST_ALL    TEST_SPO2 | TEST_STEP | TEST_EE | TEST_TIME | TEST_HR | TEST_ENCODER | TEST_AUDIO
 #define CS_HIGH do { GPIOB->BSRR = GPIO_BSRR_BS_8; } while(0)
 
@@ -36,19 +44,12 @@ int tests = TEST_NONE;
 //	Initializes all variables that will be used for the project.
 //==============================================================================
 int   i	  			= 0;
-int   prev_spo2 	= 0;
 int   spo2  		= 0;
-int   prev_HR   	= 0;
 int   HR			= 0;
-int   prev_tempF 	= 0;
 int   tempF  		= 0;
-int   prev_steps    = 0;
 int   steps 	    = 0;
-int   prev_EE_a     = 0;
 int   EE_a  		= 0;
-int	  prev_hour     = 0;
 int   hour			= 0;
-int   prev_minute   = 0;
 int   minute  		= 0;
 
 static int  ft   NO_INIT_GCC;
@@ -60,11 +61,15 @@ static char string[20];
 
 int mode = 0;
 
+enum { TASK_DAY, TASK_SAMPLE, TASK_MENU, TASK_FACE, TASK_REPORT, TASKS };
+
+#ifndef nano_wait
 static inline void nano_wait(unsigned int n) {
     asm(    "        mov r0,%0\n"
             "repeat: sub r0,#83\n"
             "        bgt repeat\n" : : "r"(n) : "r0", "cc");
 }
+#endif
 
 void init_exti(void) {
     RCC->AHBENR  |=  RCC_AHBENR_GPIOAEN;            //Clock GPIOA
@@ -104,132 +109,69 @@ void check_vitals(void) {
 	return;
 }
 
+//==============================================================================
+// UPDATE_DISPLAY
+//  * Hands the current values to the watch face, which marks the fields
+//    that changed and charts HR and SpO2.
+//==============================================================================
+void update_display(void) {
+    display_set(DISP_TIME,   hour*60 + minute);
+    display_set(DISP_SPO2,   spo2);
+    display_set(DISP_HR,     spo2 == -1 ? -1 : HR);
+    display_set(DISP_TEMP,   tempF);
+    display_set(DISP_STEPS,  steps);
+    display_set(DISP_EE,     EE_a);
+    display_set(DISP_HEIGHT, ft*12 + inch);
+    display_set(DISP_WEIGHT, wgt);
+    display_set(DISP_AGE,    age);
+    display_set(DISP_SEX,    sex);
+    display_trend(HR, spo2);
+}
+
+static int menu_shown;
+
+//==============================================================================
+// DRAW_MENU
+//  * Draws the prompt of settings mode m (1 to 7) over the bottom of the face.
+//==============================================================================
+void draw_menu(int m) {
+    static const char *const prompt[8] = {
+        0, "--ADJUST HGT (FEET)--", "--ADJUST HGT (INCH)--", "--ADJUST WGT--",
+        "--ADJUST AGE--", "--ADJUST SEX--", "--ADJUST TIME (HRS)--",
+        "--ADJUST TIME (MIN)--",
+    };
+    int x = 280;
+    switch(m) {
+    case 1: sprintf(string,"%d'",ft);                  break;
+    case 2: sprintf(string,"%2d'",inch);               break;
+    case 3: sprintf(string,"%d lbs",wgt);     x = 260; break;
+    case 4: sprintf(string,"%d yrs",age);     x = 260; break;
+    case 5: sprintf(string,"%c",sex);                  break;
+    default: sprintf(string,"%02d:%02d",hour,minute);  break;
+    }
+    LCD_DrawFillRectangle(0,214,319,239,WHITE);
+    LCD_DrawString(10,219,BLACK,WHITE,prompt[m],16|LCD_PROP,0);
+    LCD_DrawString(x,219,BLACK,WHITE,string,16,0);
+}
+
 //==============================================================================
 // EXTI2_3_IRQHandler
 //  * Uses an EXTI for PA2 to detect if the encoder button was pressed.
 //  * Cycles through the different configuration settings before returning to
 //    display.
+//  * Only changes the mode; the menu task draws the menu or the face.
 //==============================================================================
 void EXTI2_3_IRQHandler(void) {
+    static uint32_t pressed;
     EXTI->PR |= EXTI_PR_PR2;                            //Acknowledge the interrupt
-    TIM6->CR1 &= ~TIM_CR1_CEN;
-    TIM2->CR1 &= ~TIM_CR1_CEN;
-    mode++;
-    nano_wait(100000000); //Add a delay to account for "double presses"
-    //Change modes
-    if(mode == 1) {
-        LCD_Setup();
-        LCD_DrawFillRectangle(0,214,319,239,WHITE);
-        LCD_DrawString(10,219,BLACK,BLACK,"--ADJUST HGT (FEET)--",16,0xff);
-        sprintf(string,"%d'",ft);
-        LCD_DrawString(280,219,BLACK,BLACK,string,16,0xff);
-    } else if(mode == 2) {
-        LCD_DrawFillRectangle(0,214,319,239,WHITE);
-        LCD_DrawString(10,219,BLACK,BLACK,"--ADJUST HGT (INCH)--",16,0xff);
-        sprintf(string,"%2d'",inch);
-        LCD_DrawString(280,219,BLACK,BLACK,string,16,0xff);
-    } else if(mode == 3) {
-        LCD_DrawFillRectangle(0,214,319,239,WHITE);
-        LCD_DrawString(10,219,BLACK,BLACK,"--ADJUST WGT--",16,0xff);
-        sprintf(string,"%d lbs",wgt);
-        LCD_DrawString(260,219,BLACK,BLACK,string,16,0xff);
-    } else if(mode == 4) {
-        LCD_DrawFillRectangle(0,214,319,239,WHITE);
-        LCD_DrawString(10,219,BLACK,BLACK,"--ADJUST AGE--",16,0xff);
-        sprintf(string,"%d yrs",age);
-        LCD_DrawString(260,219,BLACK,BLACK,string,16,0xff);
-    } else if(mode == 5) {
-        LCD_DrawFillRectangle(0,214,319,239,WHITE);
-        LCD_DrawString(10,219,BLACK,BLACK,"--ADJUST SEX--",16,0xff);
-        sprintf(string,"%c",sex);
-        LCD_DrawString(280,219,BLACK,BLACK,string,16,0xff);
-    } else if(mode == 6) {
-        LCD_DrawFillRectangle(0,214,319,239,WHITE);
-        LCD_DrawString(10,219,BLACK,BLACK,"--ADJUST TIME (HRS)--",16,0xff);
-        sprintf(string,"%02d:%02d",hour,minute);
-        LCD_DrawString(280,219,BLACK,BLACK,string,16,0xff);
-    } else if(mode == 7) {
-        LCD_DrawFillRectangle(0,214,319,239,WHITE);
-        LCD_DrawString(10,219,BLACK,BLACK,"--ADJUST TIME (MIN)--",16,0xff);
-        sprintf(string,"%02d:%02d",hour,minute);
-        LCD_DrawString(280,219,BLACK,BLACK,string,16,0xff);
-
-    //If done editing, redraw entire thing
-    } else {
+    //Ignore the bounces of a press, and "double presses"
+    uint32_t now = sched_now();
+    if(now - pressed < SCHED_MS(100))
+        return;
+    pressed = now;
+    if(++mode > 7)
         mode = 0;
-        set_hours(hour);
-        set_minutes(minute);
-        LCD_Setup();
-        LCD_Clear(0x18e4);
-        sprintf(string,"%02d:%02d",hour,minute);
-        LCD_DrawString(104,96,0xf924,BLACK,string,48,0xff);
-
-        LCD_DrawFillRectangle(0, 0, 320, 6, 0xa65b);
-        LCD_DrawFillRectangle(0, 0, 6, 240, 0xa65b);
-        LCD_DrawFillRectangle(0, 234, 320, 240, 0xa65b);
-        LCD_DrawFillRectangle(314, 0, 320, 240, 0xa65b);
-
-        sprintf(string,"SpO2");
-        LCD_DrawString(10 + 112,10,WHITE,WHITE,string,16,0xff);
-        sprintf(string,"HR");
-        LCD_DrawString(10 + 180,10,WHITE,WHITE,string,16,0xff);
-
-        if(spo2 != -1) {
-            sprintf(string,"%-3d%%",spo2);
-            LCD_DrawString(10 + 112,10 + 16,WHITE,WHITE,string,16,0xff);
-            sprintf(string,"%-3d",HR);
-            LCD_DrawString(10 + 180,10+16,WHITE,WHITE,string,16,0xff);
-        } else {
-            LCD_DrawString(10 + 112,10+16,WHITE,WHITE,"N/A",16,0xff);
-            LCD_DrawString(10 + 180,10+16,WHITE,WHITE,"N/A",16,0xff);
-        }
-
-        sprintf(string,"TEMP");
-        LCD_DrawString(10 + 235,10,WHITE,WHITE,string,16,0xff);
-        sprintf(string,"%d.%d^F",tempF/10,tempF%10);
-        LCD_DrawString(10 + 235,10 + 16,WHITE,WHITE,string,16,0xff);
-
-        sprintf(string,"STEPS");
-        LCD_DrawString(10,10,WHITE,WHITE,string,16,0xff);
-        sprintf(string,"%-5d",steps);
-        LCD_DrawString(10,10+16,WHITE,WHITE,string,16,0xff);
-
-        sprintf(string,"EE");            //Truncate to Int
-        LCD_DrawString(10 + 64,10,WHITE,WHITE,string,16,0xff);
-        sprintf(string,"%-4d",EE_a/100);
-        LCD_DrawString(10 + 64,10 + 16,WHITE,WHITE,string,16,0xff);
-
-        sprintf(string,"HEIGHT");
-        LCD_DrawString(100,213,WHITE,WHITE,string,16,0xff);
-        sprintf(string,"%d'%2d\"",ft,inch);
-        LCD_DrawString(100,197,WHITE,WHITE,string,16,0xff);
-
-        sprintf(string,"WEIGHT",wgt);
-        LCD_DrawString(10,213,WHITE,WHITE,string,16,0xff);
-        sprintf(string,"%-3dlbs",wgt);
-        LCD_DrawString(10,197,WHITE,WHITE,string,16,0xff);
-
-        sprintf(string,"Age");
-        LCD_DrawString(200,213,WHITE,WHITE,string,16,0xff);
-        sprintf(string,"%-3d",age);
-        LCD_DrawString(200,197,WHITE,WHITE,string,16,0xff);
-
-        sprintf(string,"Sex");
-        LCD_DrawString(280,213,WHITE,WHITE,string,16,0xff);
-        sprintf(string,"%c",sex);
-        LCD_DrawString(280,197,WHITE,WHITE,string,16,0xff);
-
-        //Update previous values
-        prev_minute = minute;
-        prev_spo2   = spo2;
-        prev_HR     = HR;
-        prev_tempF  = tempF;
-        prev_steps  = steps;
-        prev_EE_a   = EE_a;
-
-        TIM6->CR1 |= TIM_CR1_CEN;
-        TIM2->CR1 |= TIM_CR1_CEN;
-    }
+    sched_post(TASK_MENU);
 
     //Used for UART Debugging
     if(tests & TEST_ENCODER)
@@ -241,6 +183,7 @@ void EXTI2_3_IRQHandler(void) {
 // EXTI0_1_IRQHandler
 //  * Uses an EXTI for PA0 and PA1 to detect whether encoder is rotated.
 //  * Changes settings based off of different modes.
+//  * The menu task redraws the prompt with the new value.
 //==============================================================================
 void EXTI0_1_IRQHandler(void) {
     EXTI->PR |= EXTI_PR_PR0; //Acknowledge the interrupt
@@ -257,10 +200,6 @@ void EXTI0_1_IRQHandler(void) {
             ft = 0;
         if(ft > 9)
             ft = 9;
-        LCD_DrawFillRectangle(0,214,319,239,WHITE);
-        LCD_DrawString(10,219,BLACK,BLACK,"--ADJUST HGT (FEET)--",16,0xff);
-        sprintf(string,"%d'",ft);
-        LCD_DrawString(280,219,BLACK,BLACK,string,16,0xff);
         RTC->BKP0R = ft;
     } else if(mode == 2) {
         inch += increment;
@@ -269,10 +208,6 @@ void EXTI0_1_IRQHandler(void) {
             inch = 0;
         if(inch > 11)
             inch = 11;
-        LCD_DrawFillRectangle(0,214,319,239,WHITE);
-        LCD_DrawString(10,219,BLACK,BLACK,"--ADJUST HGT (INCH)--",16,0xff);
-        sprintf(string,"%2d'",inch);
-        LCD_DrawString(280,219,BLACK,BLACK,string,16,0xff);
         RTC->BKP1R = inch;
     } else if(mode == 3) {
         wgt += increment;
@@ -281,10 +216,6 @@ void EXTI0_1_IRQHandler(void) {
             wgt = 50;
         if(wgt > 600)
             wgt = 600;
-        LCD_DrawFillRectangle(0,214,319,239,WHITE);
-        LCD_DrawString(10,219,BLACK,BLACK,"--ADJUST WGT--",16,0xff);
-        sprintf(string,"%d lbs",wgt);
-        LCD_DrawString(260,219,BLACK,BLACK,string,16,0xff);
         RTC->BKP2R = wgt;
     } else if(mode == 4) {
         age += increment;
@@ -292,20 +223,12 @@ void EXTI0_1_IRQHandler(void) {
             age = 0;
         if(age > 110)
             age = 110;
-        LCD_DrawFillRectangle(0,214,319,239,WHITE);
-        LCD_DrawString(10,219,BLACK,BLACK,"--ADJUST AGE--",16,0xff);
-        sprintf(string,"%d yrs",age);
-        LCD_DrawString(260,219,BLACK,BLACK,string,16,0xff);
         RTC->BKP3R = age;
     } else if(mode == 5) {
         if(sex == 'M')
             sex = 'F';
         else
             sex = 'M';
-        LCD_DrawFillRectangle(0,214,319,239,WHITE);
-        LCD_DrawString(10,219,BLACK,BLACK,"--ADJUST SEX--",16,0xff);
-        sprintf(string,"%c",sex);
-        LCD_DrawString(280,219,BLACK,BLACK,string,16,0xff);
         RTC->BKP4R = sex;
     } else if(mode == 6) {
         hour += increment;
@@ -313,10 +236,6 @@ void EXTI0_1_IRQHandler(void) {
             hour = 0;
         if(hour < 0)
             hour = 23;
-        LCD_DrawFillRectangle(0,214,319,239,WHITE);
-        LCD_DrawString(10,219,BLACK,BLACK,"--ADJUST TIME (HRS)--",16,0xff);
-        sprintf(string,"%02d:%02d",hour,minute);
-        LCD_DrawString(280,219,BLACK,BLACK,string,16,0xff);
         //TimeHr
     } else if(mode == 7) {
         //TimMin
@@ -325,11 +244,9 @@ void EXTI0_1_IRQHandler(void) {
             minute = 0;
         if(minute < 0)
             minute = 59;
-        LCD_DrawFillRectangle(0,214,319,239,WHITE);
-        LCD_DrawString(10,219,BLACK,BLACK,"--ADJUST TIME (MIN)--",16,0xff);
-        sprintf(string,"%02d:%02d",hour,minute);
-        LCD_DrawString(280,219,BLACK,BLACK,string,16,0xff);
     }
+    if(mode)
+        sched_post(TASK_MENU);
 
     if(tests & TEST_ENCODER) {
         if(!((GPIOA->IDR & 0x3)%3))
@@ -359,39 +276,134 @@ void TIM7_IRQHandler(void) {
 		GPIOA->ODR |=  0x20;
 }
 //==============================================================================
-// TIM6_DAC_IRQHandler
-//  * Samples all sensors @ 30Hz.
-//  * Also has UART debugging.
+// SAMPLING TICKS
+//  * TIM6 counts the 30Hz ticks and stamps the latest; the sample task takes
+//    one sample per run, timestamped when it starts. Ticks that passed with
+//    no sample are counted as missed, and a sample that was still running
+//    when the next tick came as an overrun. The algorithms are given the
+//    timestamps, or whole ticks, so they keep time through both.
 //==============================================================================
-void TIM6_DAC_IRQHandler(void) {
-    //Get SpO2 Data
-    pulseox_check();
-    spo2 = get_spo2();
-    HR   = get_HR();
+typedef struct {
+    uint32_t samples;
+    uint32_t missed;            //Ticks with no sample
+    uint32_t overruns;          //Samples that ran into the next tick
+    uint32_t worst_latency_us;  //From a tick to its sample starting
+} tick_stats_t;
+
+static volatile uint32_t ticks, tick_us;
+static uint32_t          last_tick;     //Tick of the last sample
+static uint32_t          sample_us;     //When the current sample started
+static tick_stats_t      tick_stats;
 
-    //Get Steps
-    accel_sample();
-    if(detect_step())
-    	steps++;
+//==============================================================================
+// SENSOR SAMPLING
+//  * One function per bus scheduler slot. Each does that sensor's I2C work for
+//    one sample and updates the matching global.
+//  * The temperature slot reads the conversion it started on its previous
+//    run and starts the next one, so it never waits on the sensor.
+//==============================================================================
+void sample_pulseox(void) {
+    PROFILE(PROF_PULSEOX, pulseox_check());
+    PROFILE(PROF_SPO2,    spo2 = get_spo2());
+    PROFILE(PROF_HR,      HR   = get_HR(sample_us));
+}
 
-    //Once a minute, update the EE counter
-    if(i == 30*60) {
-    	EE_a = EE_IEEE(wgt);
-        i = 0;
-    }
+void sample_accel(void) {
+    int step;
+    PROFILE(PROF_ACCEL, accel_sample());
+    PROFILE(PROF_STEP,  step = detect_step());
+    if(step)
+        steps++;
+}
 
-    //Get the temperature
-    tempF = get_temp();
+void sample_temp(void) {
+    int t;
+    PROFILE(PROF_TEMP, t = temp_fetch(); temp_trigger());
+    if(t != -1)
+        tempF = t;
     if(tests & TEST_TEMP)
-    	printf("Temp: %d.%dF\n",tempF/10,tempF%10);
+        printf("Temp: %d.%dF\n",tempF/10,tempF%10);
+}
+
+void sample_time(void) {
+    PROFILE(PROF_SYNC, clock_sync());
+}
+
+//==============================================================================
+// READ_CLOCK
+//  * Updates hour and minute from the MCU's clock; no bus transactions.
+//==============================================================================
+void read_clock(void) {
+    watch_datetime_t now;
+    clock_now(&now);
+    hour   = now.hour;
+    minute = now.minutes;
+}
 
-    //Get the time
-    if(!(i%10)) {//Update @ 3Hz (no need to continually update it)
-    	hour   = get_hour();
-    	minute = get_minutes();
+//==============================================================================
+// NEW_DAY
+//  * Raised by the clock once per day boundary with the date that ended,
+//    possibly from TIM14's interrupt; only keeps the date and posts the
+//    day task.
+//==============================================================================
+static watch_datetime_t day_ended;
+
+void new_day(const watch_datetime_t *ended) {
+    day_ended = *ended;
+    sched_post(TASK_DAY);
+}
+
+//==============================================================================
+// RUN_DAY
+//  * Rolls the day's counters into the history and starts them from zero.
+//    Tasks run to completion, so no sample is counted half in either day.
+//==============================================================================
+void run_day(void) {
+    day_record_t rec;
+    rec.day         = day_ended.day;
+    rec.month       = day_ended.month;
+    rec.year        = day_ended.year;
+    rec.steps       = steps;
+    rec.EE          = EE_a;
+    rec.EE_exercise = EE_new_day();
+    history_add(&rec);
+    steps = 0;
+    EE_a  = 0;
+}
+
+//==============================================================================
+// BUS SCHEDULE
+//  * (sensor, period, phase, priority, bus time per sample)
+//  * The time slot re-syncs the MCU's clock from the RTC (see clock.c).
+//  * Bus times: pulseox_check() is two 1-byte register reads and a 6-byte
+//    FIFO read, accel_sample() six 1-byte register reads, the temperature
+//    slot a pointer write plus a 2-byte read, the time one 7-byte burst.
+//==============================================================================
+#define BUS_BUDGET_US 5000  //Leaves most of the 33ms tick for the algorithms
+
+bus_slot_t bus_slots[] = {
+    { "pulseox", sample_pulseox, BUS_RATE_HZ(30), 0, 0, 2*I2C_XFER_US(4) + I2C_XFER_US(9) },
+    { "accel",   sample_accel,   BUS_RATE_HZ(30), 0, 1, 6*I2C_XFER_US(4)                  },
+    { "temp",    sample_temp,    BUS_RATE_HZ(1),  0, 2, I2C_XFER_US(2) + I2C_XFER_US(3)   },
+    { "time",    sample_time,    BUS_EVERY_S(60), 0, 3, I2C_XFER_US(10)                   },
+};
+
+//==============================================================================
+// SAMPLE_TICK
+//  * Samples the sensors due on this 30Hz tick (see BUS SCHEDULE).
+//  * Also has UART debugging.
+//==============================================================================
+void sample_tick(void) {
+    bus_sched_tick();
+    PROFILE(PROF_CLOCK, read_clock());
+
+    //Once a minute, update the EE counter
+    if(i >= 30*60) {
+    	PROFILE(PROF_EE, EE_a = EE_IEEE(wgt));
+        i -= 30*60;
     }
 
-    check_vitals();
+    PROFILE(PROF_VITALS, check_vitals());
 
     //PRINT TEST CASES TO UART
     if(tests & TEST_SPO2) {
@@ -408,9 +420,44 @@ void TIM6_DAC_IRQHandler(void) {
     	printf("TIME:  %02d:%02d\n",hour,minute);
     if(tests & TEST_HR)
     	printf("HR:    %d BPM\n",HR);
-    i++; //Increment the counter
+}
+
+//==============================================================================
+// RUN_SAMPLE
+//  * Takes the sample for the latest tick and checks it ended before the
+//    next one: TIM6's update flag is still set if its interrupt could not
+//    run yet, and the tick count has moved on if it did.
+//==============================================================================
+void run_sample(void) {
+    __disable_irq();
+    uint32_t n  = ticks;
+    uint32_t at = tick_us;
+    __enable_irq();
+    sample_us = sched_now();
+
+    uint32_t elapsed = n - last_tick;
+    last_tick = n;
+    if(elapsed > 1)
+        tick_stats.missed += elapsed - 1;
+    if(elapsed && sample_us - at > tick_stats.worst_latency_us)
+        tick_stats.worst_latency_us = sample_us - at;
+    tick_stats.samples++;
+    i += elapsed;   //Keeps the EE update once a minute
+
+    PROFILE(PROF_SAMPLE, sample_tick());
+    if((TIM6->SR & TIM_SR_UIF) || ticks != n)
+        tick_stats.overruns++;
+}
 
+//==============================================================================
+// TIM6_DAC_IRQHandler
+//  * The 30Hz sampling tick; the sample task does the work.
+//==============================================================================
+void TIM6_DAC_IRQHandler(void) {
     TIM6->SR &= ~TIM_SR_UIF; //Acknowledge Interrupt
+    tick_us = sched_now();
+    ticks++;
+    sched_post(TASK_SAMPLE);
 }
 
 
@@ -425,104 +472,93 @@ void init_tim6(void) {
 }
 
 //==============================================================================
-// TIM2_IRQHandler
-//  * Updates display once every 5 seconds.
-//  * Wanted to continually update if changes detected, but sensors take so long
-//    that LCD won't work without pausing timers, resetting the display, and
-//    redrawing everything.
-//==============================================================================
-void TIM2_IRQHandler(void) {
-	TIM6->CR1 &= ~TIM_CR1_CEN;
-    TIM2->SR &= ~TIM_SR_UIF; //Acknowledge Interrupt
-    if(minute != prev_minute | prev_spo2 != spo2 | prev_HR != HR | tempF != prev_tempF | prev_steps != steps | prev_EE_a != EE_a) {
-    	while(SPI1->SR & SPI_SR_BSY);
-    	LCD_Setup();
-    	LCD_Clear(0x18e4);
-		sprintf(string,"%02d:%02d",hour,minute);
-		while(SPI1->SR & SPI_SR_BSY);
-		LCD_DrawString(104,96,0xf924,BLACK,string,48,0xff);
-
-		LCD_DrawFillRectangle(0, 0, 320, 6, 0xa65b);
-		LCD_DrawFillRectangle(0, 0, 6, 240, 0xa65b);
-		LCD_DrawFillRectangle(0, 234, 320, 240, 0xa65b);
-		LCD_DrawFillRectangle(314, 0, 320, 240, 0xa65b);
-
-		//Reset values at midnight
-		if(midnight()) {
-		    steps = 0;
-		    EE_a  = 0;
-		}
-		sprintf(string,"SpO2");
-		LCD_DrawString(10 + 112,10,WHITE,WHITE,string,16,0xff);
-		sprintf(string,"HR");
-
-		LCD_DrawString(10 + 180,10,WHITE,WHITE,string,16,0xff);
-		if(spo2 != -1) {
-			sprintf(string,"%-3d%%",spo2);
-			LCD_DrawString(10 + 112,10 + 16,WHITE,WHITE,string,16,0xff);
-		    sprintf(string,"%-3d",HR);
-		    LCD_DrawString(10 + 180,10+16,WHITE,WHITE,string,16,0xff);
-		} else {
-		    LCD_DrawString(10 + 112,10+16,WHITE,WHITE,"N/A",16,0xff);
-		    LCD_DrawString(10 + 180,10+16,WHITE,WHITE,"N/A",16,0xff);
-		}
-
-		sprintf(string,"TEMP");
-		LCD_DrawString(10 + 235,10,WHITE,WHITE,string,16,0xff);
-		sprintf(string,"%d.%d^F",tempF/10,tempF%10);
-		LCD_DrawString(10 + 235,10 + 16,WHITE,WHITE,string,16,0xff);
-
-		sprintf(string,"STEPS");
-		LCD_DrawString(10,10,WHITE,WHITE,string,16,0xff);
-		sprintf(string,"%-5d",steps);
-		LCD_DrawString(10,10+16,WHITE,WHITE,string,16,0xff);
-
-		sprintf(string,"EE");            //Truncate to Int
-		LCD_DrawString(10 + 64,10,WHITE,WHITE,string,16,0xff);
-		sprintf(string,"%-4d",EE_a/100);
-		LCD_DrawString(10 + 64,10 + 16,WHITE,WHITE,string,16,0xff);
-
-
-		sprintf(string,"HEIGHT");
-		LCD_DrawString(100,213,WHITE,WHITE,string,16,0xff);
-		sprintf(string,"%d'%2d\"",ft,inch);
-		LCD_DrawString(100,197,WHITE,WHITE,string,16,0xff);
-
-		sprintf(string,"WEIGHT",wgt);
-		LCD_DrawString(10,213,WHITE,WHITE,string,16,0xff);
-		sprintf(string,"%-3dlbs",wgt);
-		LCD_DrawString(10,197,WHITE,WHITE,string,16,0xff);
-
-		sprintf(string,"Age");
-		LCD_DrawString(200,213,WHITE,WHITE,string,16,0xff);
-		sprintf(string,"%-3d",age);
-		LCD_DrawString(200,197,WHITE,WHITE,string,16,0xff);
-
-		sprintf(string,"Sex");
-		LCD_DrawString(280,213,WHITE,WHITE,string,16,0xff);
-		sprintf(string,"%c",sex);
-		LCD_DrawString(280,197,WHITE,WHITE,string,16,0xff);
-
-		prev_minute = minute;
-		prev_spo2   = spo2;
-		prev_HR		= HR;
-		prev_tempF  = tempF;
-		prev_steps  = steps;
-		prev_EE_a   = EE_a;
-
-		//LCD_DrawString(0,239-32,WHITE,WHITE,"HELLO THERE",32,0xff);
+// RUN_MENU
+//  * Posted when the mode or a setting changes. Entering the menu stops the
+//    sampling and the face, whose time would overwrite the one being set,
+//    and the alarm tone; leaving it applies the time, redraws the face and
+//    starts them again. In between the MCU waits in Stop mode for the
+//    encoder.
+//==============================================================================
+void run_menu(void) {
+    int m = mode;
+    if(m) {
+        if(!menu_shown) {
+            sched_stop(TASK_SAMPLE);
+            sched_stop(TASK_FACE);
+            TIM7->CR1 &= ~TIM_CR1_CEN;  //The next sample sounds it again
+            display_pause();
+            menu_shown = 1;
+        }
+        draw_menu(m);
+    } else if(menu_shown) {
+        menu_shown = 0;
+        set_hours(hour);
+        set_minutes(minute);
+        clock_load();
+        update_display();
+        LCD_Resume();
+        display_draw_all();
+        sched_start(TASK_SAMPLE);
+        last_tick = ticks;      //The menu's ticks were not missed
+        sched_start(TASK_FACE);
+    }
+}
+
+//==============================================================================
+// RUN_FACE
+//  * Hands the face its values once a second and redraws what changed.
+//==============================================================================
+void run_face(void) {
+    update_display();
+    display_update();
+}
+
+void run_report(void) {
+    if(tests & TEST_SCHED) {
+        sched_report();
+        printf("Samples %lu, missed ticks %lu, overruns %lu, worst latency %lu us\n",
+               (unsigned long)tick_stats.samples, (unsigned long)tick_stats.missed,
+               (unsigned long)tick_stats.overruns,
+               (unsigned long)tick_stats.worst_latency_us);
+        const uart_stats_t *u = uart_get_stats();
+        printf("UART %lu bytes, %lu dropped, %lu waits, %lu/%d buffered at most\n",
+               (unsigned long)u->bytes, (unsigned long)u->dropped,
+               (unsigned long)u->waits, (unsigned long)u->peak, UART_TX_BUF);
     }
-    TIM6->CR1 |=  TIM_CR1_CEN;
+#ifdef PROFILING
+    if(tests & TEST_PROFILE)
+        profile_report();
+#endif
 }
 
-void init_tim2(void) {
-	//Set to update display every 5 seconds
-    RCC->APB1ENR |= RCC_APB1ENR_TIM2EN;
-    TIM2->PSC = 4800  - 1;
-    TIM2->ARR = 50000 - 1;
-    TIM2->DIER |= TIM_DIER_UIE;
-    TIM2->CR1  |= TIM_CR1_CEN;
-    NVIC->ISER[0] |= 1 << TIM2_IRQn;
+//==============================================================================
+// TASKS
+//  * (name, function, period, deadline, priority, posted by a timer); a
+//    period of 0 is posted by an interrupt: TIM6 for the samples, TIM14
+//    (through the clock) for the day, EXTI for the menu.
+//  * A sample is due before the next one. Leaving the menu redraws the
+//    whole face, about 51ms of SPI traffic (see lcd_bench), but sampling is
+//    stopped until then; otherwise no run is longer than a face update of a
+//    few ms, so no sample waits long behind another task.
+//  * The day is not counted as timed: TIM14 only stops in the menu, and
+//    leaving it reloads the clock from the RTC, which raises a day boundary
+//    that passed in Stop.
+//==============================================================================
+const sched_task_t tasks[TASKS] = {
+    [TASK_DAY]    = { "day",    run_day,    0,               SCHED_MS(100),       0, 0 },
+    [TASK_SAMPLE] = { "sample", run_sample, 0,               1000000/BUS_TICK_HZ, 1, 1 },
+    [TASK_MENU]   = { "menu",   run_menu,   0,               SCHED_MS(100),       2, 0 },
+    [TASK_FACE]   = { "face",   run_face,   SCHED_MS(1000),  SCHED_MS(100),       3, 0 },
+    [TASK_REPORT] = { "report", run_report, SCHED_MS(10000), SCHED_MS(1000),      4, 0 },
+};
+
+//==============================================================================
+// STOP_QUIET
+//  * Stop mode freezes the SPI and USART clocks, so it waits for the LCD's
+//    DMA and for the terminal's buffer to be sent.
+//==============================================================================
+int stop_quiet(void) {
+    return !LCD_Busy() && uart_tx_idle();
 }
 
 void init_lcd_spi() {
@@ -624,7 +660,6 @@ int main(void)
 		sex = 'M';
 
     LCD_Setup();
-    LCD_Clear(BLACK);
 
 	init_i2c();
 	init_usart5();
@@ -633,9 +668,22 @@ int main(void)
 	init_accelerometer();
 	init_exti();
 	init_watch();
+	clock_on_new_day(new_day);
+	init_clock();
+	read_clock();
+	update_display();
+	display_draw_all();
+#ifdef PROFILING
+	profile_init();
+#endif
+	bus_sched_init(bus_slots, sizeof(bus_slots)/sizeof(bus_slots[0]), BUS_BUDGET_US);
+	sched_init(tasks, TASKS);
+	sched_on_stop(stop_quiet, internal_clock);
+	if(!(tests & (TEST_SCHED | TEST_PROFILE)))
+		sched_stop(TASK_REPORT);
 
     init_tim6();
-    init_tim2();
     init_tim7();
-	while(1);
+	while(1)
+		sched_run();
 }
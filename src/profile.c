@@ -0,0 +1,81 @@
+/*****************************************************************************
+ * This code keeps the cycle counts of the profiling probes. SysTick runs    *
+ * free from the 48MHz CPU clock over its full 24 bits (349ms), with no      *
+ * interrupt, so a probe costs two register reads and a call. The cycles a   *
+ * probe adds to what it measures are found once at startup and taken off    *
+ * every count.                                                              *
+ *****************************************************************************/
+#include "stm32f0xx.h"
+#include <stdio.h>
+#include "profile.h"
+
+#ifdef PROFILING
+
+#define CYCLES_PER_TICK (48000000 / 30)     //One 30Hz sampling tick
+
+typedef struct {
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t sum;
+} stage_t;
+
+static const char *const names[PROF_STAGES] = {
+    [PROF_PULSEOX] = "pulseox_check",
+    [PROF_SPO2]    = "get_spo2",
+    [PROF_HR]      = "get_HR",
+    [PROF_ACCEL]   = "accel_sample",
+    [PROF_STEP]    = "detect_step",
+    [PROF_TEMP]    = "temperature",
+    [PROF_SYNC]    = "clock_sync",
+    [PROF_CLOCK]   = "read_clock",
+    [PROF_EE]      = "EE_IEEE",
+    [PROF_VITALS]  = "check_vitals",
+    [PROF_SAMPLE]  = "sample task",
+};
+
+static stage_t  stages[PROF_STAGES];
+static uint32_t overhead;
+
+void profile_add(int stage, uint32_t cycles) {
+    stage_t *s = &stages[stage];
+    cycles = cycles > overhead ? cycles - overhead : 0;
+    if(!s->count || cycles < s->min)
+        s->min = cycles;
+    if(cycles > s->max)
+        s->max = cycles;
+    s->sum += cycles;
+    s->count++;
+}
+
+//============================================================================
+// PROFILE_REPORT
+//  * Prints each stage's runs and cycles, and its average and worst share
+//    of a sampling tick, since startup.
+//============================================================================
+void profile_report(void) {
+    printf("Stage          runs       min       avg       max  avg%%  max%%\n");
+    for(int k = 0; k < PROF_STAGES; k++) {
+        const stage_t *s = &stages[k];
+        uint32_t avg = s->count ? s->sum / s->count : 0;
+        printf("  %-13s %6lu %9lu %9lu %9lu %5.1f %5.1f\n", names[k],
+               (unsigned long)s->count, (unsigned long)s->min,
+               (unsigned long)avg, (unsigned long)s->max,
+               100.0 * avg / CYCLES_PER_TICK, 100.0 * s->max / CYCLES_PER_TICK);
+    }
+}
+
+//============================================================================
+// PROFILE_INIT
+//  * Starts SysTick and measures an empty probe.
+//============================================================================
+void profile_init(void) {
+    SysTick->LOAD = 0xffffff;
+    SysTick->VAL  = 0;
+    SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_ENABLE_Msk;
+    PROFILE(PROF_SAMPLE, );
+    overhead = stages[PROF_SAMPLE].min;
+    stages[PROF_SAMPLE] = (stage_t){ 0 };
+}
+
+#endif
@@ -6,14 +6,17 @@
  *****************************************************************************/
 #include "stm32f0xx.h"
 #include "i2c.h"
+#include "rtc.h"
 
 #define WATCH_ADDR 0x68
 
+#ifndef nano_wait
 static inline void nano_wait(unsigned int n) {
     asm(    "        mov r0,%0\n"
             "repeat: sub r0,#83\n"
             "        bgt repeat\n" : : "r"(n) : "r0", "cc");
 }
+#endif
 
 //=============================================================================
 // WATCH_WRITE
@@ -35,61 +38,88 @@ uint8_t watch_read(uint8_t reg) {
     uint8_t watch_data[1] = {reg};
     i2c_senddata(WATCH_ADDR, watch_data, 1);
     i2c_recvdata_P(WATCH_ADDR, watch_data, 1);
-    return I2C1->RXDR & 0xff;
+    return watch_data[0];
+}
+
+static int from_bcd(uint8_t bcd, uint8_t mask) {
+    bcd &= mask;
+    return (bcd >> 4)*10 + (bcd & 0xf);
+}
+
+//=============================================================================
+// WATCH_READ_DATETIME
+//  * Burst-reads Seconds through Years (0x03-0x09) in one transaction.
+//  * The PCF8523 freezes its time registers for the length of an access, so
+//    the snapshot cannot tear across a minute (or midnight) rollover the way
+//    separate register reads can.
+//  * Returns 0 on success, -1 if the transfer failed (dt is left unchanged).
+//=============================================================================
+int watch_read_datetime(watch_datetime_t *dt) {
+    uint8_t reg[1] = {0x03};
+    uint8_t raw[7];
+    if(i2c_recvdata_noP_array(WATCH_ADDR, raw, 7, reg))
+        return -1;
+    dt->osc_stopped = raw[0] >> 7;              //Crystal-Off Flag
+    dt->seconds     = from_bcd(raw[0], 0x7f);
+    dt->minutes     = from_bcd(raw[1], 0x7f);
+    dt->hour        = from_bcd(raw[2], 0x3f);
+    dt->day         = from_bcd(raw[3], 0x3f);
+    dt->dayofweek   = raw[4] & 0x7;             //0 = Sun, 1 = Mon, ...
+    dt->month       = from_bcd(raw[5], 0x1f);
+    dt->year        = from_bcd(raw[6], 0xff);
+    return 0;
 }
 
 //=============================================================================
 // GET_#########
 //  * Get the seconds/minutes/hours/etc. recorded by the RTC.
-//  * The get_seconds() algorithm also contains a bit indicating if the
-//    OSCILLATOR has stopped (usually only on startup or restart).
+//  * Each is a single snapshot read; callers needing more than one field
+//    should call watch_read_datetime() once instead.
+//  * get_seconds() returns -1 if the OSCILLATOR has stopped (usually only on
+//    startup or restart).
 //=============================================================================
 int get_seconds(void) {
-    int bcd_seconds  = watch_read(0x03);    //Get Binary-Coded-Decimal Seconds
-    if(bcd_seconds >> 7)                    //Check if Crystal-Off Flag Set
-            return -1;
-    int tens_seconds = (0x70 & bcd_seconds) >> 4;   //Calculate 10s, 1s
-    int unit_seconds = 0xf & bcd_seconds;
-    return(tens_seconds*10 + unit_seconds);         //Return seconds
+    watch_datetime_t dt = {0};
+    watch_read_datetime(&dt);
+    if(dt.osc_stopped)                      //Check if Crystal-Off Flag Set
+        return -1;
+    return dt.seconds;
 }
 
 int get_minutes(void) {
-    int bcd_minutes  = watch_read(0x04);    //Get Binary-Coded-Decimal Seconds
-    int tens_minutes = (0x70 & bcd_minutes) >> 4;   //Calculate 10s, 1s
-    int unit_minutes =  0x0f & bcd_minutes;
-    return(tens_minutes*10 + unit_minutes);         //Return minutes
+    watch_datetime_t dt = {0};
+    watch_read_datetime(&dt);
+    return dt.minutes;
 }
 
 int get_hour(void) {
-    int bcd_hour  = watch_read(0x05);        //Get Binary-Coded-Decimal Hours
-    int tens_hour = (0x30 & bcd_hour) >> 4; //Calculate 10s,1s
-    int unit_hour =  0x0f & bcd_hour;
-    return(tens_hour*10 + unit_hour);       //Return hours
+    watch_datetime_t dt = {0};
+    watch_read_datetime(&dt);
+    return dt.hour;
 }
 
 int get_day(void) {
-    int bcd_days  = watch_read(0x06);       //Get Binary-Coded-Decimal Days
-    int tens_days = (0x30 & bcd_days) >> 4; //Calculate 10s,1s
-    int unit_days =  0x0f & bcd_days;
-    return(tens_days*10 + unit_days);       //Return hours
+    watch_datetime_t dt = {0};
+    watch_read_datetime(&dt);
+    return dt.day;
 }
 
 int get_dayofweek(void) {
-    return(watch_read(0x07) & 0x3); //Return Day of Week (0 = Sun, 1 = Mon, ...)
+    watch_datetime_t dt = {0};
+    watch_read_datetime(&dt);
+    return dt.dayofweek;
 }
 
 int get_month(void) {
-    int bcd_month  = watch_read(0x08);
-    int tens_month = (0x10 & bcd_month) >> 4;
-    int unit_month =  0x0f & bcd_month;
-    return(tens_month*10 + unit_month);
+    watch_datetime_t dt = {0};
+    watch_read_datetime(&dt);
+    return dt.month;
 }
 
 int get_year(void) {
-    int bcd_year  = watch_read(0x09);
-    int tens_year = bcd_year >> 4;
-    int unit_year = bcd_year & 0xf;
-    return(tens_year*10 + unit_year);
+    watch_datetime_t dt = {0};
+    watch_read_datetime(&dt);
+    return dt.year;
 }
 
 //=============================================================================
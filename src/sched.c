@@ -0,0 +1,346 @@
+/*****************************************************************************
+ * This code runs the watch's tasks from the main loop. TIM2 counts          *
+ * microseconds freely, so every release and run can be timestamped, and its *
+ * compare channel wakes the main loop for the next periodic release. The    *
+ * timer, sensor and button interrupts only post tasks, so none of them ever *
+ * waits on the I2C bus or a frame being drawn, and a task never has to stop *
+ * another's timer to keep from being interrupted by it.                     *
+ *                                                                           *
+ * Tasks do not preempt each other: a released task waits for the running    *
+ * one to end, so the worst latency of a task is the longest run of any      *
+ * task plus the runs of those more important than it. Each task's worst     *
+ * release-to-end time is kept and a run that ends past its deadline, or a   *
+ * release that finds the task still pending, is counted as an overrun.      *
+ *                                                                           *
+ * With nothing to run, the CPU sleeps (WFI) until the next release or       *
+ * interrupt. When no started task is periodic or posted by a timer, only an *
+ * external interrupt (EXTI) can post the next one, so the scheduler goes    *
+ * further down to Stop mode, where every clock stops. The system clock      *
+ * comes back as the 8MHz HSI, so the application's wake function restarts   *
+ * the PLL. TIM2 stops too; the time spent in Stop is measured by the MCU's  *
+ * RTC, which keeps running from the LSI, and added to TIM2 so sched_now()   *
+ * does not lose it. The LSI's rate is only known to within 25%, so it is    *
+ * measured against TIM2 at startup.                                         *
+ *****************************************************************************/
+#include "stm32f0xx.h"
+#include <stdio.h>
+#include "sched.h"
+
+typedef struct {
+    uint8_t           started;
+    volatile uint8_t  pending;
+    volatile uint32_t release;  //Time of the pending release
+    uint32_t          next;     //Next periodic release
+} task_state_t;
+
+static const sched_task_t *tasks;
+static int                 ntasks;
+static task_state_t        state[SCHED_MAX_TASKS];
+static sched_stats_t       stats[SCHED_MAX_TASKS];
+static sched_power_t       power;
+static uint32_t            run_frac, sleep_frac;  //Under 1ms
+static uint64_t            stop_ticks;            //RTC ticks spent in Stop
+static uint32_t            rtc_hz;                //Measured RTC tick rate
+static int               (*stop_quiet)(void);
+static void              (*stop_wake)(void);
+
+#define STOP_RTC_HZ 20000               //Nominal LSI (40kHz) / PREDIV_A 2
+#define STOP_RTC_DAY (86400u * STOP_RTC_HZ)
+
+static void add_time(uint32_t *ms, uint32_t *frac, uint32_t us) {
+    *frac += us;
+    *ms   += *frac / 1000;
+    *frac %= 1000;
+}
+
+uint32_t sched_now(void) {
+    return TIM2->CNT;
+}
+
+//============================================================================
+// RELEASE
+//  * Makes a task pending as of time t. A task released again before it has
+//    run keeps its first release time, so the late run is still measured
+//    from when it was due.
+//============================================================================
+static void release(int k, uint32_t t) {
+    __disable_irq();
+    if(state[k].started) {
+        if(state[k].pending)
+            stats[k].missed++;
+        else {
+            state[k].release = t;
+            state[k].pending = 1;
+        }
+    }
+    __enable_irq();
+}
+
+void sched_post(int task) {
+    release(task, sched_now());
+}
+
+void sched_start(int task) {
+    state[task].next    = sched_now() + tasks[task].period_us;
+    state[task].started = 1;
+}
+
+void sched_stop(int task) {
+    __disable_irq();
+    state[task].started = 0;
+    state[task].pending = 0;
+    __enable_irq();
+}
+
+//============================================================================
+// RELEASE_DUE
+//  * Releases the periodic tasks whose time has come. Periods that went by
+//    entirely while the task was still pending are skipped and counted as
+//    missed, rather than run back to back.
+//============================================================================
+static void release_due(uint32_t now) {
+    for(int k = 0; k < ntasks; k++) {
+        uint32_t period = tasks[k].period_us;
+        if(!period || !state[k].started || (int32_t)(now - state[k].next) < 0)
+            continue;
+        release(k, state[k].next);
+        state[k].next += period;
+        if((int32_t)(now - state[k].next) >= 0) {
+            uint32_t behind = (now - state[k].next) / period + 1;
+            stats[k].missed += behind;
+            state[k].next   += behind * period;
+        }
+    }
+}
+
+//============================================================================
+// RTC_TICKS
+//  * Time of day on the MCU's RTC in 1/STOP_RTC_HZ s. The shadow registers
+//    are bypassed, so it can be read straight after Stop; SSR is read again
+//    to be sure TR did not roll over in between.
+//============================================================================
+static uint32_t rtc_ticks(void) {
+    uint32_t ss, tr;
+    do {
+        ss = RTC->SSR;
+        tr = RTC->TR;
+    } while(ss != RTC->SSR);
+    uint32_t s = ((tr >> 20) & 0x3)*36000 + ((tr >> 16) & 0xf)*3600
+               + ((tr >> 12) & 0x7)*600   + ((tr >>  8) & 0xf)*60
+               + ((tr >>  4) & 0x7)*10    +  (tr        & 0xf);
+    return s*STOP_RTC_HZ + (STOP_RTC_HZ - 1 - ss);
+}
+
+//============================================================================
+// STOP
+//  * Enters Stop mode with the regulator in low power and returns once an
+//    EXTI line has woken the MCU. Called with interrupts off; the one that
+//    woke it runs when they are turned back on.
+//  * The LSI can be anywhere from 30 to 50kHz, so the ticks are converted
+//    at the rate measured at startup. It still drifts a little with
+//    temperature and supply, so stop_ms is approximate.
+//============================================================================
+static void stop(void) {
+    uint32_t t0 = rtc_ticks();
+    PWR->CR &= ~PWR_CR_PDDS;
+    PWR->CR |=  PWR_CR_LPDS;
+    SCB->SCR |= SCB_SCR_SLEEPDEEP_Msk;
+    __WFI();
+    SCB->SCR &= ~SCB_SCR_SLEEPDEEP_Msk;
+    stop_wake();
+    uint32_t ticks = (rtc_ticks() + STOP_RTC_DAY - t0) % STOP_RTC_DAY;
+    TIM2->CNT += (uint64_t)ticks * 1000000 / rtc_hz;
+    stop_ticks += ticks;
+    power.stop_ms = stop_ticks * 1000 / rtc_hz;
+    power.stops++;
+}
+
+//============================================================================
+// IDLE
+//  * Sleeps until the next periodic release or interrupt. Interrupts are
+//    held off from the last look at the pending tasks until WFI, so a post
+//    made in between still ends the WFI instead of waiting for the next one.
+//  * Stops instead when nothing but an EXTI line can release a task and the
+//    application says its peripherals are quiet.
+//============================================================================
+static void idle(void) {
+    __disable_irq();
+    int      have  = 0;
+    int      timed = 0;
+    uint32_t wake  = 0;
+    for(int k = 0; k < ntasks; k++) {
+        if(state[k].pending) {
+            __enable_irq();
+            return;
+        }
+        if(!state[k].started)
+            continue;
+        if(tasks[k].timed)
+            timed = 1;
+        if(tasks[k].period_us && (!have || (int32_t)(state[k].next - wake) < 0)) {
+            wake = state[k].next;
+            have = 1;
+        }
+    }
+    if(!have && !timed && stop_wake && stop_quiet()) {
+        stop();
+        __enable_irq();
+        return;
+    }
+    if(have) {
+        TIM2->CCR1 = wake;
+        TIM2->SR  &= ~TIM_SR_CC1IF;
+    }
+    uint32_t t0 = sched_now();
+    if(!have || (int32_t)(wake - t0) > 0) {
+        __WFI();
+        add_time(&power.sleep_ms, &sleep_frac, sched_now() - t0);
+        power.sleeps++;
+    }
+    __enable_irq();
+}
+
+//============================================================================
+// SCHED_RUN
+//  * Called over and over by the main loop. Runs the most important pending
+//    task to completion and records how long it took, or sleeps if none is
+//    pending.
+//============================================================================
+void sched_run(void) {
+    release_due(sched_now());
+    int best = -1;
+    for(int k = 0; k < ntasks; k++)
+        if(state[k].pending && (best < 0 || tasks[k].priority < tasks[best].priority))
+            best = k;
+    if(best < 0) {
+        idle();
+        return;
+    }
+
+    __disable_irq();
+    uint32_t released = state[best].release;
+    state[best].pending = 0;
+    __enable_irq();
+
+    uint32_t start = sched_now();
+    tasks[best].run();
+    uint32_t end   = sched_now();
+
+    sched_stats_t *s = &stats[best];
+    uint32_t took = end - released;
+    add_time(&power.run_ms, &run_frac, end - start);
+    s->runs++;
+    if(took > s->worst_us)
+        s->worst_us = took;
+    if(end - start > s->worst_run_us)
+        s->worst_run_us = end - start;
+    if(took > tasks[best].deadline_us)
+        s->late++;
+}
+
+const sched_stats_t *sched_get_stats(int task) {
+    return &stats[task];
+}
+
+const sched_power_t *sched_get_power(void) {
+    return &power;
+}
+
+//============================================================================
+// SCHED_ON_STOP
+//  * Allows Stop mode. quiet() says whether the peripherals can have their
+//    clocks stopped now (no transfer under way); wake() restores the system
+//    clock after Stop.
+//============================================================================
+void sched_on_stop(int (*quiet)(void), void (*wake)(void)) {
+    stop_quiet = quiet;
+    stop_wake  = wake;
+}
+
+void sched_report(void) {
+    printf("Task       runs   late missed  worst us  (deadline)  longest run\n");
+    for(int k = 0; k < ntasks; k++)
+        printf("  %-8s %6lu %6lu %6lu %9lu %11lu %12lu\n", tasks[k].name,
+               (unsigned long)stats[k].runs, (unsigned long)stats[k].late,
+               (unsigned long)stats[k].missed, (unsigned long)stats[k].worst_us,
+               (unsigned long)tasks[k].deadline_us,
+               (unsigned long)stats[k].worst_run_us);
+    printf("Run %lu ms, sleep %lu ms (%lu), stop ~%lu ms (%lu)\n",
+           (unsigned long)power.run_ms, (unsigned long)power.sleep_ms,
+           (unsigned long)power.sleeps, (unsigned long)power.stop_ms,
+           (unsigned long)power.stops);
+}
+
+//============================================================================
+// TIM2_IRQHandler
+//  * The compare match of the next periodic release. Only ends the WFI; the
+//    main loop releases the task.
+//============================================================================
+void TIM2_IRQHandler(void) {
+    TIM2->SR &= ~TIM_SR_CC1IF; //Acknowledge Interrupt
+}
+
+//============================================================================
+// INIT_STOP_CLOCK
+//  * Runs the MCU's RTC from the LSI, counting STOP_RTC_HZ in its sub-second
+//    register. The RTC's clock can only be chosen after a backup domain
+//    reset, so one is done if it was set to another clock.
+//  * Then measures the RTC's real tick rate against TIM2 over about 100ms,
+//    starting and ending on a tick.
+//============================================================================
+static void init_stop_clock(void) {
+    RCC->APB1ENR |= RCC_APB1ENR_PWREN;
+    PWR->CR      |= PWR_CR_DBP;                 //Allow backup domain writes
+    RCC->CSR     |= RCC_CSR_LSION;
+    while(!(RCC->CSR & RCC_CSR_LSIRDY));
+    if((RCC->BDCR & RCC_BDCR_RTCSEL) != RCC_BDCR_RTCSEL_LSI) {
+        RCC->BDCR |=  RCC_BDCR_BDRST;
+        RCC->BDCR &= ~RCC_BDCR_BDRST;
+        RCC->BDCR |=  RCC_BDCR_RTCSEL_LSI;
+    }
+    RCC->BDCR |= RCC_BDCR_RTCEN;
+
+    RTC->WPR = 0xca;                            //Unlock
+    RTC->WPR = 0x53;
+    RTC->ISR |= RTC_ISR_INIT;
+    while(!(RTC->ISR & RTC_ISR_INITF));
+    RTC->PRER = STOP_RTC_HZ - 1;                //PREDIV_S, then PREDIV_A
+    RTC->PRER |= 1 << 16;
+    RTC->CR  |= RTC_CR_BYPSHAD;
+    RTC->ISR &= ~RTC_ISR_INIT;
+    RTC->WPR = 0xff;                            //Lock
+
+    uint32_t r0 = rtc_ticks();
+    while(rtc_ticks() == r0);
+    r0 = rtc_ticks();
+    uint32_t t0 = sched_now();
+    uint32_t ticks;
+    do
+        ticks = (rtc_ticks() + STOP_RTC_DAY - r0) % STOP_RTC_DAY;
+    while(ticks < STOP_RTC_HZ / 10);
+    rtc_hz = (uint64_t)ticks * 1000000 / (sched_now() - t0);
+}
+
+//============================================================================
+// SCHED_INIT
+//  * Starts TIM2 counting microseconds (48MHz/48) over its full 32 bits, and
+//    starts every task; the first periodic releases are one period away.
+//  * Starts the RTC that times Stop mode, which takes about 100ms.
+//============================================================================
+void sched_init(const sched_task_t *table, int n) {
+    tasks  = table;
+    ntasks = n < SCHED_MAX_TASKS ? n : SCHED_MAX_TASKS;
+
+    RCC->APB1ENR |= RCC_APB1ENR_TIM2EN;
+    TIM2->PSC  = 48 - 1;
+    TIM2->ARR  = 0xffffffff;
+    TIM2->EGR  = TIM_EGR_UG;    //Load the prescaler
+    TIM2->SR   = 0;
+    TIM2->DIER |= TIM_DIER_CC1IE;
+    TIM2->CR1  |= TIM_CR1_CEN;
+    NVIC->ISER[0] |= 1 << TIM2_IRQn;
+    init_stop_clock();
+
+    for(int k = 0; k < ntasks; k++)
+        sched_start(k);
+}
@@ -53,26 +53,51 @@ void init_temp_sensor(void) {
 	temp_write(0x2,0x0,0x0);
 }
 
+#ifndef nano_wait
 static inline void nano_wait(unsigned int n) {
     asm(    "        mov r0,%0\n"
             "repeat: sub r0,#83\n"
             "        bgt repeat\n" : : "r"(n) : "r0", "cc");
 }
+#endif
+
+//============================================================================
+// TEMP_TRIGGER
+//	* Sets the pointer to the temperature register, which starts a
+//	  conversion. The result is ready 6.35ms later (14-bit).
+//============================================================================
+void temp_trigger(void) {
+	uint8_t temp_reg[1] = {0x00};
+	i2c_senddata(HDC_ADDR,temp_reg,1); //Set pointer (starts a conversion)
+}
+
+//============================================================================
+// TEMP_FETCH
+//	* Reads the last conversion and returns it in 10*F.
+//	* Returns -1 if the sensor NACKs (no conversion started, or it has not
+//	  finished yet).
+//============================================================================
+int temp_fetch(void) {
+	char temp_arr[2];
+	if(i2c_recvdata_P(HDC_ADDR,temp_arr,2))
+		return -1;
+	int   temp_16 = (temp_arr[0] << 8) | (temp_arr[1]);
+	float temp_C  = ((float)temp_16 /(float)65536) * 160 - 40; //Convert 16bit to C
+	return(18*temp_C + 320);									   //Convert to 10*F
+}
 
 //============================================================================
 // GET_TEMP
 //	* Reads temperature and returns in F.
 //    NOTE: Sensor returns 10*tempF. Also, needs a nanowait between setting
-//          the pointer and reading the value.
+//          the pointer and reading the value. Callers that sample
+//          periodically should use temp_trigger()/temp_fetch() on separate
+//          ticks instead of blocking here.
 //============================================================================
 int get_temp(void) {
-	i2c_senddata(HDC_ADDR,0x02,1); //Set pointer
+	temp_trigger();
 	nano_wait(20000000);		   //Datasheet requires waiting 20ms
-	char temp_arr[2];
-	i2c_recvdata_P(HDC_ADDR,temp_arr,2);
-	int   temp_16 = (temp_arr[0] << 8) | (temp_arr[1]);
-	float temp_C  = ((float)temp_16 /(float)65536) * 160 - 40; //Convert 16bit to C
-	return(18*temp_C + 320);									   //Convert to 10*F
+	return temp_fetch();
 }
 
 //============================================================================
@@ -161,7 +186,7 @@ void pulseox_check(void)
     Rd &= 0x3ffff;
     //printf("R%6d  I%6d\n",Rd,IR);
 
-    for(int i = 300; i > 0; i -= 2) {
+    for(int i = 299; i > 2; i -= 2) {
     	led_arr[i]   = led_arr[i-2];
     	led_arr[i-1] = led_arr[i-3];
     }
@@ -218,8 +243,13 @@ int get_spo2(void) {
     //printf("%.4f\n",spo2);
 }
 
+//Beats of 16 to 49 samples at 30Hz; the limits are halfway between ticks
+//so a beat timed a little early or late is not taken for the next count.
+#define HR_MIN_BEAT_US (15*1000000/30 + 1000000/60)
+#define HR_MAX_BEAT_US (49*1000000/30 + 1000000/60)
+
 //
-int count = 0;
+uint32_t last_peak_us = 0;
 int sampl_hr[7] = {70,70,70,70,70,70,70};
 int hr_avg;
 //============================================================================
@@ -227,8 +257,11 @@ int hr_avg;
 //	* Gives user HR. Works by looking for a peak (one value surrounded by
 //	  several smaller values. Then, takes average of last few samples to
 //	  consider noise and bad measurements.
+//	* t_us is when this sample was taken (any microsecond clock). Beats are
+//	  timed from it rather than by counting samples, so a late or missed
+//	  sampling tick does not change the rate.
 //============================================================================
-int get_HR(void) {
+int get_HR(uint32_t t_us) {
 	//Check if at a peak
 	if(led_arr[8] > led_arr[0] && led_arr[8] > led_arr[2]
 	  && led_arr[8] > led_arr[4]
@@ -238,10 +271,11 @@ int get_HR(void) {
 	  && led_arr[8] > red_avg) {
 
 		//Check for realistic pulses
-		// [36BPM to 120BPM]
+		// [37BPM to 112BPM]
 		// Realistically, people are unlikely to have values that surpass
 		// these without being in the hospital.
-		if(count > 15 && count < 50 && red_min > 1500) {
+		uint32_t beat_us = t_us - last_peak_us;
+		if(beat_us > HR_MIN_BEAT_US && beat_us < HR_MAX_BEAT_US && red_min > 1500) {
 
 			//Find average HR for last 7 samples
 			hr_avg = 0;
@@ -249,16 +283,15 @@ int get_HR(void) {
 				hr_avg += sampl_hr[i];
 				sampl_hr[i] = sampl_hr[i-1];
 			}
-			sampl_hr[0] = 1800/count;
+			sampl_hr[0] = 60000000/beat_us;
 			hr_avg += sampl_hr[0];
 			//printf("Heart Rate: %d\n",hr_avg/10);
 		}
-	    //printf("Time: %d\n",count);
-   	count = 0;
+	    //printf("Time: %lu\n",beat_us);
+   	last_peak_us = t_us;
     }
 
-	//Reset the counter and return the final heartrate
-    count++;
+	//Return the final heartrate
 	return(hr_avg/7);
 }
 
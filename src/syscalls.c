@@ -59,6 +59,7 @@
 extern int errno;
 extern int __io_putchar(int ch) __attribute__((weak));
 extern int __io_getchar(void) __attribute__((weak));
+extern int uart_write(const char *s, int len);
 
 register char * stack_ptr asm("sp");
 
@@ -100,14 +101,11 @@ int _read (int file, char *ptr, int len)
 return len;
 }
 
+/* Queued for USART5 without waiting; bytes that do not fit are counted
+   as dropped, not reported, so printf never retries them */
 int _write(int file, char *ptr, int len)
 {
-	int DataIdx;
-
-	for (DataIdx = 0; DataIdx < len; DataIdx++)
-	{
-		__io_putchar(*ptr++);
-	}
+	uart_write(ptr, len);
 	return len;
 }
 
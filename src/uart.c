@@ -2,11 +2,22 @@
  * This code contains functions for sending data to the serial port for      *
  * debugging without using the TFT display. Useful for sensors-to-MCU and    *
  * watch and accelerometer data subsystems.                                  *
+ *                                                                           *
+ * Each character takes 87us at 115.2kBps, so printing is buffered: writes   *
+ * are copied into a ring and the TXE interrupt sends it one byte at a time. *
+ * Debug output from the sampling task then costs microseconds, not a        *
+ * millisecond a line.                                                       *
  *****************************************************************************/
 #include "stm32f0xx.h"
 #include <stdio.h>
 #include "uart.h"
 
+static char              tx_buf[UART_TX_BUF];
+static volatile uint32_t tx_head;   //Next byte to queue
+static volatile uint32_t tx_tail;   //Next byte to send
+static int               tx_policy = UART_TX_DROP;
+static uart_stats_t      stats;
+
 //============================================================================
 // INIT_USART5
 //  * Configures PC12 to transmit to USART5
@@ -40,21 +51,134 @@ void init_usart5(void) {
 
     //Wait until ready
     while((USART5->ISR & 0x200000) == 0);
+    NVIC->ISER[0] = 1 << USART3_8_IRQn;
 
     setbuf(stdin,0);
     setbuf(stdout,0);
     setbuf(stderr,0);
 }
 
+//============================================================================
+// USART3_8_IRQHandler
+//  * Sends the next byte of the ring each time the transmitter is empty;
+//    turns itself off when the ring is.
+//============================================================================
+void USART3_8_IRQHandler(void) {
+    if(!(USART5->ISR & USART_ISR_TXE))
+        return;
+    if(tx_tail == tx_head) {
+        USART5->CR1 &= ~USART_CR1_TXEIE;
+        return;
+    }
+    USART5->TDR = tx_buf[tx_tail % UART_TX_BUF];
+    tx_tail++;
+}
+
+//============================================================================
+// TX_POLL
+//  * Sends one byte by polling, for a blocking write that the interrupt
+//    cannot help: interrupts are off, or it is called from one.
+//============================================================================
+static void tx_poll(void) {
+    while(!(USART5->ISR & USART_ISR_TXE)) {}
+    USART5->TDR = tx_buf[tx_tail % UART_TX_BUF];
+    tx_tail++;
+}
+
+//============================================================================
+// TX_WAIT
+//  * Waits until the ring has room for n bytes. Called with interrupts off;
+//    they are let in while waiting if the caller had them on, otherwise the
+//    ring is sent by polling.
+//============================================================================
+static void tx_wait(uint32_t n, int irq_on) {
+    while(UART_TX_BUF - (tx_head - tx_tail) < n) {
+        if(irq_on) {
+            __enable_irq();
+            __disable_irq();
+        } else
+            tx_poll();
+    }
+}
+
+//============================================================================
+// TX_PUT
+//  * Queues one byte; returns 0 if the ring is full and the policy is to
+//    drop. Under UART_TX_BLOCK it waits for room instead, which only happens
+//    for a write longer than the ring.
+//============================================================================
+static int tx_put(char c, int irq_on, int *waited) {
+    if(tx_head - tx_tail >= UART_TX_BUF) {
+        if(tx_policy != UART_TX_BLOCK)
+            return 0;
+        *waited = 1;
+        tx_wait(1, irq_on);
+    }
+    tx_buf[tx_head % UART_TX_BUF] = c;
+    tx_head++;
+    stats.bytes++;
+    if(tx_head - tx_tail > stats.peak)
+        stats.peak = tx_head - tx_tail;
+    return 1;
+}
+
+//============================================================================
+// UART_WRITE
+//  * Queues len bytes, with each '\n' sent as "\r\n", and starts the
+//    interrupt. Safe from interrupts; one write is never split by another.
+//  * Under UART_TX_BLOCK it first waits for room for the whole write, so the
+//    copy itself never lets interrupts in. A write longer than the ring
+//    cannot fit at once and may be split.
+//  * Returns how many of the bytes were taken.
+//============================================================================
+int uart_write(const char *s, int len) {
+    //Waiting on the interrupt only works if it can preempt the caller
+    uint32_t primask = __get_PRIMASK();
+    int irq_on = !primask && !(SCB->ICSR & SCB_ICSR_VECTACTIVE_Msk);
+    int waited = 0;
+    int n      = 0;
+    uint32_t need = len;
+    for(int k = 0; k < len; k++)
+        if(s[k] == '\n')
+            need++;
+    __disable_irq();
+    if(tx_policy == UART_TX_BLOCK && UART_TX_BUF - (tx_head - tx_tail) < need) {
+        waited = 1;
+        tx_wait(need < UART_TX_BUF ? need : UART_TX_BUF, irq_on);
+    }
+    for(; n < len; n++) {
+        if(s[n] == '\n' && !tx_put('\r', irq_on, &waited))
+            break;
+        if(!tx_put(s[n], irq_on, &waited))
+            break;
+    }
+    if(tx_head != tx_tail)
+        USART5->CR1 |= USART_CR1_TXEIE;
+    stats.dropped += len - n;
+    if(waited)
+        stats.waits++;
+    __set_PRIMASK(primask);
+    return n;
+}
+
 //============================================================================
 // __io_putchar
 //  * Helper function to allow printf to send characters to the terminal
 //============================================================================
 int __io_putchar(int c) {
-    while(!(USART5->ISR & USART_ISR_TXE)) {}
-    if(c == '\n')
-        USART5->TDR = '\r';
-        while(!(USART5->ISR & USART_ISR_TXE)) {}
-    USART5->TDR = c;
+    char ch = c;
+    uart_write(&ch, 1);
     return c;
 }
+
+void uart_tx_policy(int policy) {
+    tx_policy = policy;
+}
+
+int uart_tx_idle(void) {
+    return tx_head == tx_tail && (USART5->ISR & USART_ISR_TC);
+}
+
+const uart_stats_t *uart_get_stats(void) {
+    return &stats;
+}